@@ -0,0 +1,456 @@
+/**
+ * @file btree/avl/btree.c
+ * @brief Binary Search Tree - AVL (Self-Balancing) Variant
+ * @details This file implements the binary search tree interface from btree.h as an
+ *          AVL tree. Every node stores the height of its subtree and after each insertion
+ *          or deletion the heights of the two subtrees of any node differ by at most one.
+ *          The height of the whole tree is therefore bounded by about 1.44 * log2(n), even
+ *          when the keys are inserted in sorted order, which turns the recursive and the
+ *          iterative variants into linked lists.
+ *
+ *          The key functions implemented in this file include:
+ *          - bst_init: Initializes the BST.
+ *          - bst_insert: Inserts or updates a node and rebalances the tree.
+ *          - bst_search: Searches for a node in the BST.
+ *          - bst_delete: Deletes a node and rebalances the tree.
+ *          - bst_dispose: Frees the entire BST.
+ *          - bst_preorder: Performs a preorder tree traversal.
+ *          - bst_inorder: Performs an inorder tree traversal.
+ *          - bst_postorder: Performs a postorder tree traversal.
+ *          - bst_replace_by_rightmost: Helper function for node deletion.
+ *
+ *          Rebalancing is done by single and double rotations on the way back up from
+ *          the modified node, so the operations are recursive. The recursion depth is
+ *          bounded by the height of the tree, which stays logarithmic.
+ *
+ * @code
+ * bst_node_t *tree;
+ * bst_init(&tree);
+ * for (char key = 'A'; key <= 'Z'; key++) {
+ *     bst_insert(&tree, key, key - 'A'); // sorted input, the tree stays balanced
+ * }
+ * bst_dispose(&tree);
+ * @endcode
+ *
+ * @see btree.h for type definitions and function prototypes.
+ * @see btree/rec/btree.c for the unbalanced recursive variant.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project02-2021 for the project repository.
+ */
+
+#include "../btree.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief Returns the height of a subtree.
+ *
+ * @param tree The root of the subtree, may be NULL.
+ *
+ * @retval 0 The subtree is empty.
+ * @retval >0 The height stored in the root node, 1 for a leaf.
+ */
+static int avl_height(bst_node_t *tree) {
+    return tree != NULL ? tree->height : 0;
+}
+
+/**
+ * @brief Recomputes the height of a node from the heights of its descendants.
+ *
+ * @param node The node to update, must not be NULL.
+ *
+ * @pre The heights of both descendants are up to date.
+ *
+ * @return This function does not return a value.
+ */
+static void avl_update_height(bst_node_t *node) {
+    int leftHeight = avl_height(node->left);
+    int rightHeight = avl_height(node->right);
+    node->height = (leftHeight > rightHeight ? leftHeight : rightHeight) + 1;
+}
+
+/**
+ * @brief Returns the balance factor of a node.
+ *
+ * @param node The node, must not be NULL.
+ *
+ * @return The height of the left subtree minus the height of the right subtree.
+ */
+static int avl_balance(bst_node_t *node) {
+    return avl_height(node->left) - avl_height(node->right);
+}
+
+/**
+ * @brief Rotates the subtree to the left.
+ *
+ * @details The right descendant becomes the root of the subtree and the old root becomes
+ *          its left descendant. The heights of both moved nodes are updated.
+ *
+ * @param tree A double pointer to the root of the subtree.
+ *
+ * @pre The root has a right descendant.
+ *
+ * @return This function does not return a value.
+ */
+static void avl_rotate_left(bst_node_t **tree) {
+    bst_node_t *rootPtr = *tree;
+    bst_node_t *pivot = rootPtr->right;
+
+    rootPtr->right = pivot->left;
+    pivot->left = rootPtr;
+    avl_update_height(rootPtr);
+    avl_update_height(pivot);
+    *tree = pivot;
+}
+
+/**
+ * @brief Rotates the subtree to the right.
+ *
+ * @details Mirror image of `avl_rotate_left`.
+ *
+ * @param tree A double pointer to the root of the subtree.
+ *
+ * @pre The root has a left descendant.
+ *
+ * @return This function does not return a value.
+ */
+static void avl_rotate_right(bst_node_t **tree) {
+    bst_node_t *rootPtr = *tree;
+    bst_node_t *pivot = rootPtr->left;
+
+    rootPtr->left = pivot->right;
+    pivot->right = rootPtr;
+    avl_update_height(rootPtr);
+    avl_update_height(pivot);
+    *tree = pivot;
+}
+
+/**
+ * @brief Restores the AVL property at the root of a subtree.
+ *
+ * @details Updates the height of the root and, when its balance factor is outside of
+ *          <-1, 1>, performs a single or a double rotation. Both subtrees must already be
+ *          valid AVL trees whose heights differ by at most two, which holds after a single
+ *          insertion or deletion below the root.
+ *
+ * @param tree A double pointer to the root of the subtree, may point to NULL.
+ *
+ * @post The subtree is a valid AVL tree and '*tree' points to its (possibly new) root.
+ *
+ * @return This function does not return a value.
+ */
+static void avl_rebalance(bst_node_t **tree) {
+
+    // If the subtree is empty
+    if (*tree == NULL) {
+        return;
+    }
+
+    bst_node_t *rootPtr = *tree;
+    avl_update_height(rootPtr);
+    int balance = avl_balance(rootPtr);
+
+    // If the left subtree is too high
+    if (balance > 1) {
+        // Left-right case, straighten the left subtree first
+        if (avl_balance(rootPtr->left) < 0) {
+            avl_rotate_left(&rootPtr->left);
+        }
+        avl_rotate_right(tree);
+    }
+    // If the right subtree is too high
+    else if (balance < -1) {
+        // Right-left case, straighten the right subtree first
+        if (avl_balance(rootPtr->right) > 0) {
+            avl_rotate_right(&rootPtr->right);
+        }
+        avl_rotate_left(tree);
+    }
+}
+
+/**
+ * @brief Initializes a binary search tree to an empty state.
+ *
+ * @param tree A double pointer to the binary search tree that will be initialized.
+ *
+ * @warning If 'tree' already points to an initialized binary search tree, this operation
+ *          will lead to memory leaks unless the nodes are freed beforehand.
+ *
+ * @return This function does not return a value.
+ */
+void bst_init(bst_node_t **tree) {
+    // NULL check
+    if (tree != NULL) {
+        *tree = NULL;
+    }
+}
+
+/**
+ * @brief Searches for a node with the specified key in the tree.
+ *
+ * @details The tree is balanced, so a simple loop down from the root visits at most
+ *          O(log n) nodes and no rebalancing is needed.
+ *
+ * @param tree The root node of the binary search tree to search within.
+ * @param key The key of the node to search for.
+ * @param value Pointer to an integer where the value of the found node will be written.
+ *
+ * @post If a node with the specified key is found, 'value' is updated with the node's value.
+ *       Otherwise, 'value' remains unchanged.
+ *
+ * @retval true A node with the specified key was found and 'value' was updated.
+ * @retval false No node with the specified key was found and 'value' was not updated.
+ */
+bool bst_search(bst_node_t *tree, char key, int *value) {
+    while (tree != NULL) {
+        // If the node with the searched key is found
+        if (tree->key == key) {
+            *value = tree->value;
+            return true;
+        }
+        tree = key < tree->key ? tree->left : tree->right;
+    }
+    return false;
+}
+
+/**
+ * @brief Adds or updates a node and rebalances the tree.
+ *
+ * @details Descends recursively to the place of the key. A new node is created as a leaf
+ *          of height 1; on the way back up every node on the path gets its height updated
+ *          and is rotated if it became unbalanced. At most one (single or double) rotation
+ *          is performed per insertion. Updating the value of an existing key does not
+ *          change the shape of the tree.
+ *
+ * @param tree A double pointer to the root of the binary search tree.
+ * @param key The unique identifier for the node.
+ * @param value The associated value for the node.
+ *
+ * @pre 'tree' references the root pointer of a valid AVL tree (which may be NULL).
+ *
+ * @post The tree contains the key with the given value and is balanced.
+ *
+ * @code
+ * bst_node_t *tree;
+ * bst_init(&tree);
+ * bst_insert(&tree, 'A', 1);
+ * bst_insert(&tree, 'B', 2);
+ * bst_insert(&tree, 'C', 3); // rotation, 'B' becomes the root
+ * @endcode
+ *
+ * @warning If memory allocation for a new node fails, the function silently fails without
+ *          inserting.
+ *
+ * @return This function does not return a value.
+ */
+void bst_insert(bst_node_t **tree, char key, int value) {
+
+    // NULL check
+    if (tree == NULL) {
+        return;
+    }
+
+    // Current tree root
+    bst_node_t *rootPtr = *tree;
+
+    // If the subtree is empty
+    if (rootPtr == NULL) {
+        // Allocate and initialize a new leaf
+        rootPtr = malloc(sizeof(bst_node_t));
+        if (rootPtr == NULL) {
+            return;
+        }
+        rootPtr->key = key;
+        rootPtr->value = value;
+        rootPtr->left = NULL;
+        rootPtr->right = NULL;
+        rootPtr->height = 1;
+        *tree = rootPtr;
+        return;
+    }
+
+    // If the key is on the left
+    if (key < rootPtr->key) {
+        bst_insert(&rootPtr->left, key, value);
+    }
+    // If the key is on the right
+    else if (rootPtr->key < key) {
+        bst_insert(&rootPtr->right, key, value);
+    }
+    // The keys are equal, the shape does not change
+    else {
+        rootPtr->value = value;
+        return;
+    }
+
+    avl_rebalance(tree);
+}
+
+/**
+ * @brief Replaces the target node with the rightmost node of a subtree and rebalances.
+ *
+ * @details Moves the key and value of the rightmost node of 'tree' to 'target' and removes
+ *          the rightmost node. Its left subtree (at most one node, by the AVL property)
+ *          takes its place. Every node on the path back up is rebalanced.
+ *
+ * @param target Pointer to the node whose key and value will be replaced.
+ * @param tree Double pointer to the root of the non-empty subtree containing the rightmost node.
+ *
+ * @pre 'tree' points to a non-empty AVL subtree.
+ *
+ * @post The rightmost node is freed and the subtree is balanced.
+ *
+ * @return This function does not return a value.
+ */
+void bst_replace_by_rightmost(bst_node_t *target, bst_node_t **tree) {
+
+    // NULL check
+    if (tree == NULL || *tree == NULL) {
+        return;
+    }
+
+    // Current tree root
+    bst_node_t *rootPtr = *tree;
+
+    // If there's a path to the right, move right
+    if (rootPtr->right != NULL) {
+        bst_replace_by_rightmost(target, &rootPtr->right);
+        avl_rebalance(tree);
+    }
+    else {// No path to the right, update target and unlink the node
+        target->key = rootPtr->key;
+        target->value = rootPtr->value;
+        *tree = rootPtr->left;
+        free(rootPtr);
+    }
+}
+
+/**
+ * @brief Removes a node with the specified key and rebalances the tree.
+ *
+ * @details Works as in the recursive variant: a node with at most one descendant is replaced
+ *          by that descendant and a node with two descendants takes over the key and value of
+ *          the rightmost node of its left subtree, which is removed instead. Every node on the
+ *          path from the removed node back to the root is rebalanced; unlike insertion, a
+ *          deletion may need a rotation at each level.
+ *
+ * @param tree A double pointer to the root of the binary search tree.
+ * @param key The key of the node to be removed.
+ *
+ * @pre 'tree' references the root pointer of a valid AVL tree.
+ *
+ * @post The node with the specified key is removed, if it existed, and the tree is balanced.
+ *
+ * @return This function does not return a value.
+ */
+void bst_delete(bst_node_t **tree, char key) {
+
+    // NULL check
+    if (tree == NULL) {
+        return;
+    }
+
+    // Current tree root
+    bst_node_t *rootPtr = *tree;
+
+    // If the tree is empty
+    if (rootPtr == NULL) {
+        return;
+    }
+    // If the searched key is on the left
+    else if (key < rootPtr->key) {
+        bst_delete(&rootPtr->left, key);
+    }
+    // If the searched key is on the right
+    else if (rootPtr->key < key) {
+        bst_delete(&rootPtr->right, key);
+    }
+    // If the subtree has both descendants
+    else if (rootPtr->left != NULL && rootPtr->right != NULL) {
+        bst_replace_by_rightmost(rootPtr, &rootPtr->left);
+    }
+    // The node has at most one descendant, which takes its place
+    else {
+        *tree = rootPtr->left != NULL ? rootPtr->left : rootPtr->right;
+        free(rootPtr);
+        return;
+    }
+
+    avl_rebalance(tree);
+}
+
+/**
+ * @brief Eliminates all nodes from the tree, deallocating memory.
+ *
+ * @details Recursion depth is bounded by the height of the tree, which is logarithmic.
+ *
+ * @param tree A double pointer to the root of the binary search tree to be disposed of.
+ *
+ * @post 'tree' is set to NULL and all memory has been freed.
+ *
+ * @return This function does not return a value.
+ */
+void bst_dispose(bst_node_t **tree) {
+
+    // NULL check
+    if (tree == NULL) {
+        return;
+    }
+
+    // If the tree is not empty
+    if (*tree != NULL) {
+        // Dispose the left and right subtrees
+        bst_dispose(&((*tree)->left));
+        bst_dispose(&((*tree)->right));
+        // Free the root
+        free(*tree);
+        *tree = NULL;
+    }
+}
+
+/**
+ * @brief Traverses the tree in preorder (root, left, right) and prints the nodes.
+ *
+ * @param tree The root node of the binary search tree to traverse.
+ *
+ * @return This function does not return a value.
+ */
+void bst_preorder(bst_node_t *tree) {
+    if (tree != NULL) {
+        bst_print_node(tree);
+        bst_preorder(tree->left);
+        bst_preorder(tree->right);
+    }
+}
+
+/**
+ * @brief Traverses the tree in inorder (left, root, right) and prints the nodes.
+ *
+ * @param tree The root node of the binary search tree to traverse.
+ *
+ * @return This function does not return a value.
+ */
+void bst_inorder(bst_node_t *tree) {
+    if (tree != NULL) {
+        bst_inorder(tree->left);
+        bst_print_node(tree);
+        bst_inorder(tree->right);
+    }
+}
+
+/**
+ * @brief Traverses the tree in postorder (left, right, root) and prints the nodes.
+ *
+ * @param tree The root node of the binary search tree to traverse.
+ *
+ * @return This function does not return a value.
+ */
+void bst_postorder(bst_node_t *tree) {
+    if (tree != NULL) {
+        bst_postorder(tree->left);
+        bst_postorder(tree->right);
+        bst_print_node(tree);
+    }
+}
+
+/* End of btree/avl/btree.c */
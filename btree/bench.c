@@ -0,0 +1,100 @@
+#include "btree.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Every char value is a key, so the tree has 256 nodes
+#define KEY_COUNT (CHAR_MAX - CHAR_MIN + 1)
+#define ROUNDS 2000
+#define SEARCHES 20
+
+typedef enum order { sorted, reversed, shuffled } order_t;
+
+static double now_seconds() {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Keeps the compiler from dropping the lookups
+volatile int sink;
+
+static int tree_height(bst_node_t *tree) {
+  if (tree == NULL) {
+    return 0;
+  }
+  int left_height = tree_height(tree->left);
+  int right_height = tree_height(tree->right);
+  return (left_height > right_height ? left_height : right_height) + 1;
+}
+
+void make_keys(char keys[], order_t order) {
+  for (int i = 0; i < KEY_COUNT; i++) {
+    keys[i] = (char)(order == reversed ? CHAR_MAX - i : CHAR_MIN + i);
+  }
+  if (order == shuffled) {
+    srand(42);
+    for (int i = KEY_COUNT - 1; i > 0; i--) {
+      int j = rand() % (i + 1);
+      char tmp = keys[i];
+      keys[i] = keys[j];
+      keys[j] = tmp;
+    }
+  }
+}
+
+void bench_order(const char *name, order_t order) {
+  char keys[KEY_COUNT];
+  make_keys(keys, order);
+
+  double insert = 0, search = 0, delete = 0;
+  int height = 0;
+
+  for (int round = 0; round < ROUNDS; round++) {
+    bst_node_t *tree;
+    bst_init(&tree);
+
+    double start = now_seconds();
+    for (int i = 0; i < KEY_COUNT; i++) {
+      bst_insert(&tree, keys[i], i);
+    }
+    insert += now_seconds() - start;
+    height = tree_height(tree);
+
+    start = now_seconds();
+    for (int s = 0; s < SEARCHES; s++) {
+      for (int i = 0; i < KEY_COUNT; i++) {
+        int value;
+        bst_search(tree, keys[i], &value);
+        sink = value;
+      }
+    }
+    search += now_seconds() - start;
+
+    start = now_seconds();
+    for (int i = 0; i < KEY_COUNT; i++) {
+      bst_delete(&tree, keys[i]);
+    }
+    delete += now_seconds() - start;
+
+    bst_dispose(&tree);
+  }
+
+  printf("%-9s %7i %10.1f %10.1f %10.1f\n", name, height,
+         insert * 1e9 / ROUNDS / KEY_COUNT,
+         search * 1e9 / ROUNDS / SEARCHES / KEY_COUNT,
+         delete * 1e9 / ROUNDS / KEY_COUNT);
+}
+
+int main(int argc, char *argv[]) {
+  printf("%i keys, %i rounds\n\n", KEY_COUNT, ROUNDS);
+  printf("%-9s %7s %10s %10s %10s\n", "input", "height", "insert ns",
+         "search ns", "delete ns");
+  bench_order("sorted", sorted);
+  bench_order("reversed", reversed);
+  bench_order("random", shuffled);
+  return 0;
+}
+
+/* End of btree/bench.c */
@@ -0,0 +1,116 @@
+#include "bst_compact.h"
+#include "btree.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Every char value is a key, so a tree has 256 nodes. The trees of the
+// forest together are much larger than the cache.
+#define KEY_COUNT (CHAR_MAX - CHAR_MIN + 1)
+#define TREE_COUNT 4096
+#define QUERY_COUNT 4000000
+
+static double now_seconds() {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Keeps the compiler from dropping the lookups
+volatile int sink;
+
+bst_node_t *trees[TREE_COUNT];
+bst_compact_t inserted[TREE_COUNT];
+bst_compact_t copied[TREE_COUNT];
+int query_trees[QUERY_COUNT];
+char query_keys[QUERY_COUNT];
+
+void shuffle(char keys[]) {
+  for (int i = KEY_COUNT - 1; i > 0; i--) {
+    int j = rand() % (i + 1);
+    char tmp = keys[i];
+    keys[i] = keys[j];
+    keys[j] = tmp;
+  }
+}
+
+void report(const char *name, size_t node_size, double seconds) {
+  printf("%-16s %10i %10.1f %10.1f\n", name, (int)node_size,
+         (double)node_size * KEY_COUNT * TREE_COUNT / (1 << 20),
+         seconds * 1e9 / QUERY_COUNT);
+}
+
+int main(int argc, char *argv[]) {
+  char keys[KEY_COUNT];
+  for (int i = 0; i < KEY_COUNT; i++) {
+    keys[i] = (char)(CHAR_MIN + i);
+  }
+
+  srand(42);
+  for (int t = 0; t < TREE_COUNT; t++) {
+    shuffle(keys);
+    bst_init(&trees[t]);
+    bst_compact_init(&inserted[t]);
+    bst_compact_init(&copied[t]);
+    for (int i = 0; i < KEY_COUNT; i++) {
+      bst_insert(&trees[t], keys[i], i);
+      bst_compact_insert(&inserted[t], keys[i], i);
+    }
+    bst_compact_from_tree(&copied[t], trees[t]);
+  }
+  for (int q = 0; q < QUERY_COUNT; q++) {
+    query_trees[q] = rand() % TREE_COUNT;
+    query_keys[q] = (char)(CHAR_MIN + rand() % KEY_COUNT);
+  }
+
+  printf("%i trees of %i keys, %i random lookups\n\n", TREE_COUNT, KEY_COUNT,
+         QUERY_COUNT);
+  printf("%-16s %10s %10s %10s\n", "layout", "node B", "total MiB",
+         "search ns");
+
+  int value = 0;
+  double start = now_seconds();
+  for (int q = 0; q < QUERY_COUNT; q++) {
+    bst_search(trees[query_trees[q]], query_keys[q], &value);
+    sink = value;
+  }
+  report("pointer", sizeof(bst_node_t), now_seconds() - start);
+
+  start = now_seconds();
+  for (int q = 0; q < QUERY_COUNT; q++) {
+    bst_compact_search(&inserted[query_trees[q]], query_keys[q], &value);
+    sink = value;
+  }
+  report("compact insert", sizeof(bst_compact_node_t), now_seconds() - start);
+
+  start = now_seconds();
+  for (int q = 0; q < QUERY_COUNT; q++) {
+    bst_compact_search(&copied[query_trees[q]], query_keys[q], &value);
+    sink = value;
+  }
+  report("compact BFS", sizeof(bst_compact_node_t), now_seconds() - start);
+
+  // Saving a whole tree is one write of its node array
+  FILE *file = tmpfile();
+  if (file != NULL) {
+    start = now_seconds();
+    for (int t = 0; t < TREE_COUNT; t++) {
+      bst_compact_save(&copied[t], file);
+    }
+    fflush(file);
+    double saved = now_seconds() - start;
+    printf("\nsave: %li bytes, %.1f us per tree\n", ftell(file),
+           saved * 1e6 / TREE_COUNT);
+    fclose(file);
+  }
+
+  for (int t = 0; t < TREE_COUNT; t++) {
+    bst_dispose(&trees[t]);
+    bst_compact_dispose(&inserted[t]);
+    bst_compact_dispose(&copied[t]);
+  }
+  return 0;
+}
+
+/* End of btree/bench_compact.c */
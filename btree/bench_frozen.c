@@ -0,0 +1,113 @@
+#include "bst_frozen.h"
+#include "btree.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Every char value is a key, so a tree has 256 nodes. The trees of the
+// forest together are much larger than the cache.
+#define KEY_COUNT (CHAR_MAX - CHAR_MIN + 1)
+#define TREE_COUNT 4096
+#define QUERY_COUNT 4000000
+
+static double now_seconds() {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Keeps the compiler from dropping the lookups
+volatile int sink;
+
+bst_node_t *trees[TREE_COUNT];
+bst_frozen_t eytzinger[TREE_COUNT];
+bst_frozen_t veb[TREE_COUNT];
+int query_trees[QUERY_COUNT];
+char query_keys[QUERY_COUNT];
+
+void shuffle(char keys[]) {
+  for (int i = KEY_COUNT - 1; i > 0; i--) {
+    int j = rand() % (i + 1);
+    char tmp = keys[i];
+    keys[i] = keys[j];
+    keys[j] = tmp;
+  }
+}
+
+void report(const char *name, double seconds) {
+  printf("%-10s %10.1f %12.1f\n", name, seconds * 1e9 / QUERY_COUNT,
+         QUERY_COUNT / seconds / 1e6);
+}
+
+void bench_frozen(const char *name, bst_frozen_t frozen[]) {
+  int value = 0;
+  double start = now_seconds();
+  for (int q = 0; q < QUERY_COUNT; q++) {
+    bst_frozen_search(&frozen[query_trees[q]], query_keys[q], &value);
+    sink = value;
+  }
+  report(name, now_seconds() - start);
+}
+
+int main(int argc, char *argv[]) {
+  char keys[KEY_COUNT];
+  for (int i = 0; i < KEY_COUNT; i++) {
+    keys[i] = (char)(CHAR_MIN + i);
+  }
+
+  // Shuffled inserts, with every other key missing so half of the lookups fail
+  srand(42);
+  for (int t = 0; t < TREE_COUNT; t++) {
+    shuffle(keys);
+    bst_init(&trees[t]);
+    for (int i = 0; i < KEY_COUNT; i++) {
+      if (keys[i] % 2 == 0) {
+        bst_insert(&trees[t], keys[i], i);
+      }
+    }
+    bst_frozen_init(&eytzinger[t]);
+    bst_frozen_init(&veb[t]);
+  }
+
+  double start = now_seconds();
+  for (int t = 0; t < TREE_COUNT; t++) {
+    bst_freeze(&eytzinger[t], trees[t], bst_eytzinger);
+  }
+  double freeze_eytzinger = now_seconds() - start;
+  start = now_seconds();
+  for (int t = 0; t < TREE_COUNT; t++) {
+    bst_freeze(&veb[t], trees[t], bst_veb);
+  }
+  double freeze_veb = now_seconds() - start;
+
+  for (int q = 0; q < QUERY_COUNT; q++) {
+    query_trees[q] = rand() % TREE_COUNT;
+    query_keys[q] = (char)(CHAR_MIN + rand() % KEY_COUNT);
+  }
+
+  printf("%i trees of %i keys, %i random lookups\n", TREE_COUNT, KEY_COUNT / 2,
+         QUERY_COUNT);
+  printf("freeze: eytzinger %.1f us, veb %.1f us per tree\n\n",
+         freeze_eytzinger * 1e6 / TREE_COUNT, freeze_veb * 1e6 / TREE_COUNT);
+  printf("%-10s %10s %12s\n", "layout", "search ns", "M lookups/s");
+
+  int value = 0;
+  start = now_seconds();
+  for (int q = 0; q < QUERY_COUNT; q++) {
+    bst_search(trees[query_trees[q]], query_keys[q], &value);
+    sink = value;
+  }
+  report("pointer", now_seconds() - start);
+  bench_frozen("eytzinger", eytzinger);
+  bench_frozen("veb", veb);
+
+  for (int t = 0; t < TREE_COUNT; t++) {
+    bst_dispose(&trees[t]);
+    bst_frozen_dispose(&eytzinger[t]);
+    bst_frozen_dispose(&veb[t]);
+  }
+  return 0;
+}
+
+/* End of btree/bench_frozen.c */
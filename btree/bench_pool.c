@@ -0,0 +1,107 @@
+#include "bst_pool.h"
+#include "btree.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Every char value is a key, so a full tree has 256 nodes
+#define KEY_COUNT (CHAR_MAX - CHAR_MIN + 1)
+#define CHURN_OPERATIONS 4000000
+#define BUILD_ROUNDS 20000
+
+static double now_seconds() {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Keeps the compiler from dropping the lookups
+volatile int sink;
+
+// Random inserts and deletes on a half-full tree, returns ns per operation
+double bench_churn() {
+  char keys[KEY_COUNT];
+  for (int i = 0; i < KEY_COUNT; i++) {
+    keys[i] = (char)(CHAR_MIN + i);
+  }
+
+  bst_node_t *tree;
+  bst_init(&tree);
+  for (int i = 0; i < KEY_COUNT; i += 2) {
+    bst_insert(&tree, keys[i], i);
+  }
+
+  srand(42);
+  double start = now_seconds();
+  for (int i = 0; i < CHURN_OPERATIONS; i++) {
+    char key = keys[rand() % KEY_COUNT];
+    if (i % 2 == 0) {
+      bst_insert(&tree, key, i);
+    } else {
+      bst_delete(&tree, key);
+    }
+  }
+  double elapsed = now_seconds() - start;
+
+  int value = 0;
+  bst_search(tree, keys[0], &value);
+  sink = value;
+  bst_dispose(&tree);
+  return elapsed * 1e9 / CHURN_OPERATIONS;
+}
+
+// Builds a full tree and drops it, returns ns per node
+double bench_build(bst_pool_t *pool) {
+  char keys[KEY_COUNT];
+  for (int i = 0; i < KEY_COUNT; i++) {
+    keys[i] = (char)(CHAR_MIN + i);
+  }
+  srand(7);
+  for (int i = KEY_COUNT - 1; i > 0; i--) {
+    int j = rand() % (i + 1);
+    char tmp = keys[i];
+    keys[i] = keys[j];
+    keys[j] = tmp;
+  }
+
+  double start = now_seconds();
+  for (int round = 0; round < BUILD_ROUNDS; round++) {
+    bst_node_t *tree;
+    bst_init(&tree);
+    for (int i = 0; i < KEY_COUNT; i++) {
+      bst_insert(&tree, keys[i], i);
+    }
+    sink = tree->value;
+    if (pool != NULL) {
+      bst_pool_reset(pool);
+    } else {
+      bst_dispose(&tree);
+    }
+  }
+  return (now_seconds() - start) * 1e9 / BUILD_ROUNDS / KEY_COUNT;
+}
+
+int main(int argc, char *argv[]) {
+  bst_pool_t pool;
+  bst_pool_init(&pool, 0);
+
+  printf("%i churn operations, %i build rounds of %i keys\n\n",
+         CHURN_OPERATIONS, BUILD_ROUNDS, KEY_COUNT);
+  printf("%-9s %10s %16s\n", "allocator", "churn ns", "build+drop ns");
+
+  double churn = bench_churn();
+  double build = bench_build(NULL);
+  printf("%-9s %10.1f %16.1f\n", "malloc", churn, build);
+
+  bst_pool_use(&pool);
+  churn = bench_churn();
+  build = bench_build(&pool);
+  bst_pool_use(NULL);
+  printf("%-9s %10.1f %16.1f\n", "pool", churn, build);
+
+  bst_pool_free(&pool);
+  return 0;
+}
+
+/* End of btree/bench_pool.c */
@@ -0,0 +1,69 @@
+#include "btree.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define NODE_COUNT 10000000
+
+static double now_seconds() {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Builds a balanced tree of the nodes [low, high) with values in key order.
+// Keys repeat since they are chars; the traversals do not compare them.
+bst_node_t *make_balanced(int low, int high) {
+  if (low >= high) {
+    return NULL;
+  }
+  int middle = low + (high - low) / 2;
+  bst_node_t *node = malloc(sizeof(bst_node_t));
+  if (node == NULL) {
+    return NULL;
+  }
+  node->key = 'A' + middle % 26;
+  node->value = middle;
+  node->left = make_balanced(low, middle);
+  node->right = make_balanced(middle + 1, high);
+  return node;
+}
+
+int visit_nothing(bst_node_t *node, void *context) { return 0; }
+
+int visit_sum(bst_node_t *node, void *context) {
+  *(long long *)context += node->value;
+  return 0;
+}
+
+void report(const char *name, double seconds) {
+  fprintf(stderr, "%-18s %8.1f ms %8.2f ns/node\n", name, seconds * 1e3,
+          seconds * 1e9 / NODE_COUNT);
+}
+
+// The printed nodes go to stdout, run as ./bench_visit > /dev/null
+int main(int argc, char *argv[]) {
+  bst_node_t *tree = make_balanced(0, NODE_COUNT);
+
+  fprintf(stderr, "%i nodes, inorder\n\n", NODE_COUNT);
+
+  double start = now_seconds();
+  bst_inorder(tree);
+  fflush(stdout);
+  report("printf", now_seconds() - start);
+
+  start = now_seconds();
+  bst_visit_inorder(tree, visit_nothing, NULL);
+  report("no-op visitor", now_seconds() - start);
+
+  long long sum = 0;
+  start = now_seconds();
+  bst_visit_inorder(tree, visit_sum, &sum);
+  report("sum visitor", now_seconds() - start);
+  fprintf(stderr, "\nsum %lld\n", sum);
+
+  bst_dispose(&tree);
+  return 0;
+}
+
+/* End of btree/bench_visit.c */
@@ -0,0 +1,150 @@
+/**
+ * @file btree/bst_build.c
+ * @brief Binary Search Tree - Bulk Build from Sorted Input
+ * @details Builds a height-balanced binary search tree from keys that are already sorted, in
+ *          O(n) time and a single pass over the input. Repeated `bst_insert` costs
+ *          O(n log n) at best and O(n^2) for sorted input on the unbalanced variants.
+ *
+ *          The tree is built bottom-up: the left subtree of a node is built from the next
+ *          keys of the input first, then the node takes the following key and finally its
+ *          right subtree is built. Every key is therefore read exactly once, in order.
+ *
+ *          All nodes come from one allocation. They are laid out in preorder, so the root is
+ *          the first element and a step to the left child is a step to the next element,
+ *          which keeps the top levels of the tree in a few cache lines.
+ *
+ *          Key functions implemented:
+ *          - bst_build_sorted: Builds the tree from sorted keys and values.
+ *          - bst_dispose_sorted: Releases a tree built by bst_build_sorted.
+ *
+ * @code
+ * const char keys[] = {'A', 'B', 'C', 'D', 'E'};
+ * const int values[] = {1, 2, 3, 4, 5};
+ * bst_node_t *tree = bst_build_sorted(keys, values, 5); // 'C' is the root
+ * int value;
+ * bst_search(tree, 'D', &value);
+ * bst_dispose_sorted(&tree);
+ * @endcode
+ *
+ * @warning The nodes are not individually allocated. A built tree must only be read (search,
+ *          traversals, ranges, rank and select) and released by `bst_dispose_sorted`, never
+ *          by `bst_insert`, `bst_delete` or `bst_dispose`.
+ *
+ * @see btree.h for the prototypes.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project02-2021 for the project repository.
+ */
+
+#include "btree.h"
+#include <stdlib.h>
+
+// State of the build shared by the recursive calls
+typedef struct bst_build {
+    const char *keys;   // next key to be placed
+    const int *values;  // next value to be placed
+    bst_node_t *nodes;  // next free node, in preorder
+} bst_build_t;
+
+/**
+ * @brief Builds a balanced subtree of the next 'count' keys of the input.
+ *
+ * @details Takes the node for the subtree root first (preorder placement), builds the left
+ *          subtree from the first half of the keys, assigns the middle key to the root and
+ *          builds the right subtree from the rest. The depth of the recursion is the height
+ *          of the tree, ceil(log2(count + 1)).
+ *
+ * @param build The state of the build.
+ * @param count The number of keys in the subtree.
+ *
+ * @return The root of the subtree, NULL if 'count' is 0.
+ */
+static bst_node_t *bst_build_subtree(bst_build_t *build, int count) {
+
+    // If the subtree is empty
+    if (count == 0) {
+        return NULL;
+    }
+
+    bst_node_t *node = build->nodes++;
+    int leftCount = count / 2;
+
+    node->left = bst_build_subtree(build, leftCount);
+    node->key = *build->keys++;
+    node->value = *build->values++;
+    node->right = bst_build_subtree(build, count - leftCount - 1);
+
+    // Subtree size and height; the tree is height-balanced, so the heights are valid AVL
+    // heights. No colour is set: an all-black tree is not a valid red-black tree unless it
+    // is perfect.
+    node->size = count;
+    int leftHeight = node->left != NULL ? node->left->height : 0;
+    int rightHeight = node->right != NULL ? node->right->height : 0;
+    node->height = (leftHeight > rightHeight ? leftHeight : rightHeight) + 1;
+
+    return node;
+}
+
+/**
+ * @brief Builds a height-balanced tree from sorted keys in O(n).
+ *
+ * @details Checks that the keys are strictly increasing, allocates all nodes at once and
+ *          builds the tree bottom-up. The heights of the two subtrees of every node differ by
+ *          at most one and the tree has the minimal height ceil(log2(count + 1)). The subtree
+ *          sizes used by `bst_count_range`, `bst_rank` and `bst_select` are filled in.
+ *
+ * @param keys The keys in strictly increasing order.
+ * @param values The values belonging to the keys.
+ * @param count The number of keys.
+ *
+ * @post The returned tree owns a single block of memory; release it by `bst_dispose_sorted`.
+ *
+ * @retval NULL 'count' is not positive, the keys are not strictly increasing or the
+ *              allocation failed.
+ * @retval non-NULL The root of the tree, also the start of the node block.
+ */
+bst_node_t *bst_build_sorted(const char keys[], const int values[], int count) {
+
+    // NULL check
+    if (keys == NULL || values == NULL || count <= 0) {
+        return NULL;
+    }
+
+    // The keys must be sorted and unique
+    for (int i = 1; i < count; i++) {
+        if (keys[i - 1] >= keys[i]) {
+            return NULL;
+        }
+    }
+
+    bst_node_t *nodes = malloc(count * sizeof(bst_node_t));
+    if (nodes == NULL) {
+        return NULL;
+    }
+
+    bst_build_t build = {keys, values, nodes};
+    return bst_build_subtree(&build, count);
+}
+
+/**
+ * @brief Releases a tree built by `bst_build_sorted`.
+ *
+ * @details The root is the start of the node block, so a single `free` releases every node.
+ *
+ * @param tree A double pointer to the root of the tree.
+ *
+ * @post 'tree' is set to NULL.
+ *
+ * @return This function does not return a value.
+ */
+void bst_dispose_sorted(bst_node_t **tree) {
+
+    // NULL check
+    if (tree == NULL) {
+        return;
+    }
+
+    free(*tree);
+    *tree = NULL;
+}
+
+/* End of btree/bst_build.c */
@@ -0,0 +1,544 @@
+/**
+ * @file btree/bst_compact.c
+ * @brief Binary Search Tree - Compact Index-Based Layout
+ * @details A binary search tree whose nodes are stored in one contiguous array and link to
+ *          their children by 32-bit indices into that array. A `bst_compact_node_t` takes
+ *          16 bytes, while a `bst_node_t` with its two 64-bit pointers and the per-variant
+ *          fields takes 32, so twice as many nodes fit into a cache line and the tree needs
+ *          no per-node allocation.
+ *
+ *          The nodes always occupy slots 1..count without holes: a node appended by
+ *          `bst_compact_insert` takes slot count + 1 and `bst_compact_delete` moves the last
+ *          node into the slot it frees. Index 0 (`BST_COMPACT_NIL`) stands for no node, so
+ *          slot 0 is free to carry the header of a saved tree. Since the indices do not depend
+ *          on where the array is in memory, `bst_compact_save` writes the header and all
+ *          nodes with a single `fwrite` and `bst_compact_load` reads them back as they are.
+ *
+ *          The tree is not balanced; it has the same shape as the one built by `bst_insert`
+ *          of the rec and iter variants for the same operations. All operations are
+ *          iterative.
+ *
+ *          Key functions implemented:
+ *          - bst_compact_init: Initializes an empty tree.
+ *          - bst_compact_insert: Inserts a key or updates its value.
+ *          - bst_compact_search: Searches for a key.
+ *          - bst_compact_delete: Deletes a key.
+ *          - bst_compact_dispose: Releases the node array.
+ *          - bst_compact_from_tree: Copies a `bst_node_t` tree.
+ *          - bst_compact_save, bst_compact_load: Write and read the tree in binary form.
+ *
+ * @code
+ * bst_compact_t tree;
+ * bst_compact_init(&tree);
+ * bst_compact_insert(&tree, 'B', 2);
+ * bst_compact_insert(&tree, 'A', 1);
+ * FILE *file = fopen("tree.bin", "wb");
+ * bst_compact_save(&tree, file); // 3 slots of 16 bytes
+ * fclose(file);
+ * bst_compact_dispose(&tree);
+ * @endcode
+ *
+ * @warning A saved tree uses the byte order and `int` size of the machine that wrote it.
+ *
+ * @see bst_compact.h for type definitions.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project02-2021 for the project repository.
+ */
+
+#include "bst_compact.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Capacity of the node array after its first allocation
+#define BST_COMPACT_INITIAL_CAPACITY 16
+
+// Number of nodes read at once by bst_compact_load
+#define BST_COMPACT_LOAD_CHUNK 4096
+
+/**
+ * @brief Makes room for at least 'slots' slots in the node array.
+ *
+ * @details Doubles the capacity until it suffices. The new slots are zeroed, so the padding
+ *          of the nodes written by `bst_compact_save` is deterministic. At most
+ *          BST_COMPACT_MAX_COUNT + 1 slots are allowed, so doubling the capacity from
+ *          BST_COMPACT_INITIAL_CAPACITY never overflows.
+ *
+ * @param tree A pointer to an initialized tree.
+ * @param slots The number of slots needed, including slot 0.
+ *
+ * @post On failure the tree is unchanged.
+ *
+ * @retval true The array has room for 'slots' slots.
+ * @retval false Too many slots were requested or the allocation failed.
+ */
+static bool bst_compact_reserve(bst_compact_t *tree, uint32_t slots) {
+
+    // If there is enough room already
+    if (slots <= tree->capacity) {
+        return true;
+    }
+
+    // The count is limited, 'slots' may also have wrapped around to 0 above
+    if (slots == 0 || slots > BST_COMPACT_MAX_COUNT + 1) {
+        return false;
+    }
+
+    uint32_t capacity = tree->capacity > 0 ? tree->capacity : BST_COMPACT_INITIAL_CAPACITY;
+    while (capacity < slots) {
+        capacity *= 2;
+    }
+    if (capacity > SIZE_MAX / sizeof(bst_compact_node_t)) {
+        return false;
+    }
+
+    size_t bytes = (size_t) capacity * sizeof(bst_compact_node_t);
+    bst_compact_node_t *nodes = realloc(tree->nodes, bytes);
+    if (nodes == NULL) {
+        return false;
+    }
+    memset(nodes + tree->capacity, 0,
+           (size_t) (capacity - tree->capacity) * sizeof(bst_compact_node_t));
+
+    tree->nodes = nodes;
+    tree->capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief Returns the link that points to a child of 'parent'.
+ *
+ * @param tree A pointer to the tree.
+ * @param parent The index of the parent, BST_COMPACT_NIL for the root link.
+ * @param left Whether the left or the right link of 'parent' is wanted.
+ *
+ * @warning The pointer is invalidated by `bst_compact_reserve`.
+ *
+ * @return A pointer to the root index or to the child index of 'parent'.
+ */
+static uint32_t *bst_compact_link(bst_compact_t *tree, uint32_t parent, bool left) {
+    if (parent == BST_COMPACT_NIL) {
+        return &tree->root;
+    }
+    return left ? &tree->nodes[parent].left : &tree->nodes[parent].right;
+}
+
+/**
+ * @brief Checks that the node array forms a single tree.
+ *
+ * @details Walks the tree from the root with an explicit stack, marking every reached node.
+ *          The walk fails on a child index outside slots 1..count and on a node reached for
+ *          the second time, which covers shared subtrees and cycles. At the end, all 'count'
+ *          nodes must have been reached.
+ *
+ * @param tree A pointer to a tree with 'root', 'count' and the nodes filled in.
+ *
+ * @retval true Every node is reached exactly once from the root.
+ * @retval false The nodes do not form a tree or an allocation failed.
+ */
+static bool bst_compact_check(bst_compact_t *tree) {
+    uint32_t count = tree->count;
+    bool *reached = calloc((size_t) count + 1, sizeof(bool));
+    uint32_t *stack = malloc((size_t) count * sizeof(uint32_t));
+    if (reached == NULL || stack == NULL) {
+        free(reached);
+        free(stack);
+        return false;
+    }
+
+    bool valid = true;
+    uint32_t reachedCount = 0;
+    uint32_t top = 0;
+    if (tree->root != BST_COMPACT_NIL) {
+        stack[top++] = tree->root;
+    }
+    while (valid && top > 0) {
+        uint32_t index = stack[--top];
+        if (index > count || reached[index]) {
+            valid = false;
+            break;
+        }
+        reached[index] = true;
+        reachedCount++;
+
+        // At most 'count' - 'reachedCount' nodes can still be pushed without a repeat
+        uint32_t children[2] = {tree->nodes[index].left, tree->nodes[index].right};
+        for (int i = 0; i < 2; i++) {
+            if (children[i] == BST_COMPACT_NIL) {
+                continue;
+            }
+            if (top == count) {
+                valid = false;
+                break;
+            }
+            stack[top++] = children[i];
+        }
+    }
+
+    free(reached);
+    free(stack);
+    return valid && reachedCount == count;
+}
+
+/**
+ * @brief Initializes an empty tree.
+ *
+ * @details No memory is allocated until the first insert.
+ *
+ * @param tree A pointer to the tree to be initialized.
+ *
+ * @return This function does not return a value.
+ */
+void bst_compact_init(bst_compact_t *tree) {
+
+    // NULL check
+    if (tree == NULL) {
+        return;
+    }
+
+    tree->nodes = NULL;
+    tree->root = BST_COMPACT_NIL;
+    tree->count = 0;
+    tree->capacity = 0;
+}
+
+/**
+ * @brief Inserts a key with its value into the tree.
+ *
+ * @details Walks down from the root remembering the parent and the side to go to. If the
+ *          key is found, its value is replaced. Otherwise the new node is appended after the
+ *          last node and linked to the remembered parent as a leaf.
+ *
+ * @param tree A pointer to an initialized tree.
+ * @param key The key to be inserted.
+ * @param value The value belonging to the key.
+ *
+ * @post If the node array could not grow, the tree is unchanged.
+ *
+ * @return This function does not return a value.
+ */
+void bst_compact_insert(bst_compact_t *tree, char key, int value) {
+
+    // NULL check
+    if (tree == NULL) {
+        return;
+    }
+
+    uint32_t parent = BST_COMPACT_NIL;
+    uint32_t index = tree->root;
+    bool left = false;
+    while (index != BST_COMPACT_NIL) {
+        bst_compact_node_t *node = &tree->nodes[index];
+        if (key == node->key) {
+            node->value = value;
+            return;
+        }
+        parent = index;
+        left = key < node->key;
+        index = left ? node->left : node->right;
+    }
+
+    if (!bst_compact_reserve(tree, tree->count + 2)) {
+        return;
+    }
+
+    index = ++tree->count;
+    bst_compact_node_t *node = &tree->nodes[index];
+    node->left = BST_COMPACT_NIL;
+    node->right = BST_COMPACT_NIL;
+    node->value = value;
+    node->key = key;
+    *bst_compact_link(tree, parent, left) = index;
+}
+
+/**
+ * @brief Searches for a key in the tree.
+ *
+ * @param tree A pointer to an initialized tree.
+ * @param key The key to be searched for.
+ * @param value A pointer where the value of the key is stored if it is found.
+ *
+ * @retval true The key was found and its value stored in 'value'.
+ * @retval false The key is not in the tree.
+ */
+bool bst_compact_search(bst_compact_t *tree, char key, int *value) {
+
+    // NULL check
+    if (tree == NULL) {
+        return false;
+    }
+
+    uint32_t index = tree->root;
+    while (index != BST_COMPACT_NIL) {
+        const bst_compact_node_t *node = &tree->nodes[index];
+        if (key == node->key) {
+            if (value != NULL) {
+                *value = node->value;
+            }
+            return true;
+        }
+        index = key < node->key ? node->left : node->right;
+    }
+    return false;
+}
+
+/**
+ * @brief Deletes a key from the tree.
+ *
+ * @details A node with at most one child is replaced by that child. A node with two
+ *          children takes the key and value of the rightmost node of its left subtree, which
+ *          is removed instead, like in `bst_delete`. The slot of the removed node is then
+ *          filled with the last node of the array: its parent is found by searching for its
+ *          key and re-linked to the new slot. The array therefore stays free of holes.
+ *
+ * @param tree A pointer to an initialized tree.
+ * @param key The key to be deleted.
+ *
+ * @post If the key is not in the tree, nothing happens.
+ *
+ * @return This function does not return a value.
+ */
+void bst_compact_delete(bst_compact_t *tree, char key) {
+
+    // NULL check
+    if (tree == NULL) {
+        return;
+    }
+
+    // Find the node and the link pointing to it
+    uint32_t *link = &tree->root;
+    while (*link != BST_COMPACT_NIL && tree->nodes[*link].key != key) {
+        bst_compact_node_t *node = &tree->nodes[*link];
+        link = key < node->key ? &node->left : &node->right;
+    }
+    if (*link == BST_COMPACT_NIL) {
+        return;
+    }
+
+    uint32_t removed = *link;
+    bst_compact_node_t *target = &tree->nodes[removed];
+    if (target->left != BST_COMPACT_NIL && target->right != BST_COMPACT_NIL) {
+        // Remove the rightmost node of the left subtree instead
+        link = &target->left;
+        while (tree->nodes[*link].right != BST_COMPACT_NIL) {
+            link = &tree->nodes[*link].right;
+        }
+        removed = *link;
+        target->key = tree->nodes[removed].key;
+        target->value = tree->nodes[removed].value;
+        *link = tree->nodes[removed].left;
+    }
+    else {
+        *link = target->left != BST_COMPACT_NIL ? target->left : target->right;
+    }
+
+    // Move the last node into the freed slot
+    uint32_t last = tree->count;
+    if (removed != last) {
+        char lastKey = tree->nodes[last].key;
+        link = &tree->root;
+        while (*link != last) {
+            bst_compact_node_t *node = &tree->nodes[*link];
+            link = lastKey < node->key ? &node->left : &node->right;
+        }
+        *link = removed;
+        tree->nodes[removed] = tree->nodes[last];
+    }
+    memset(&tree->nodes[last], 0, sizeof(bst_compact_node_t));
+    tree->count--;
+}
+
+/**
+ * @brief Releases the node array, leaving an empty tree.
+ *
+ * @param tree A pointer to an initialized tree.
+ *
+ * @post The tree is empty and can be used again.
+ *
+ * @return This function does not return a value.
+ */
+void bst_compact_dispose(bst_compact_t *tree) {
+
+    // NULL check
+    if (tree == NULL) {
+        return;
+    }
+
+    free(tree->nodes);
+    bst_compact_init(tree);
+}
+
+/**
+ * @brief Replaces the contents of the tree by a copy of a `bst_node_t` tree.
+ *
+ * @details Copies the nodes in breadth-first order, so the root takes slot 1 and the top
+ *          levels share the first cache lines. A queue of source nodes runs alongside the
+ *          node array: slot i holds the copy of the i-th queued node, and the children of a
+ *          node get the next free slots when it is copied. The shape of the tree is kept.
+ *
+ * @param tree A pointer to an initialized tree.
+ * @param source The root of the tree to be copied, may be NULL.
+ *
+ * @pre 'source' must be a valid binary search tree.
+ *
+ * @post On failure the tree is empty.
+ *
+ * @retval true The tree was copied.
+ * @retval false 'tree' is NULL or an allocation failed.
+ */
+bool bst_compact_from_tree(bst_compact_t *tree, bst_node_t *source) {
+
+    // NULL check
+    if (tree == NULL) {
+        return false;
+    }
+
+    bst_compact_dispose(tree);
+    if (source == NULL) {
+        return true;
+    }
+
+    bst_node_t **queue = NULL;
+    uint32_t queueCapacity = 0;
+    uint32_t count = 1;
+
+    for (uint32_t index = 1; index <= count; index++) {
+        // Keep the queue as long as the node array
+        if (!bst_compact_reserve(tree, count + 3)) {
+            free(queue);
+            bst_compact_dispose(tree);
+            return false;
+        }
+        if (queueCapacity < tree->capacity) {
+            bst_node_t **newQueue = realloc(queue, tree->capacity * sizeof(bst_node_t *));
+            if (newQueue == NULL) {
+                free(queue);
+                bst_compact_dispose(tree);
+                return false;
+            }
+            queue = newQueue;
+            queueCapacity = tree->capacity;
+        }
+
+        bst_node_t *node = index == 1 ? source : queue[index];
+        bst_compact_node_t *copy = &tree->nodes[index];
+        copy->key = node->key;
+        copy->value = node->value;
+        copy->left = BST_COMPACT_NIL;
+        copy->right = BST_COMPACT_NIL;
+        if (node->left != NULL) {
+            copy->left = ++count;
+            queue[count] = node->left;
+        }
+        if (node->right != NULL) {
+            copy->right = ++count;
+            queue[count] = node->right;
+        }
+    }
+
+    free(queue);
+    tree->root = 1;
+    tree->count = count;
+    return true;
+}
+
+/**
+ * @brief Writes the tree to a binary file.
+ *
+ * @details Slot 0 is filled with the header (root index in 'left', node count in 'right'
+ *          and BST_COMPACT_MAGIC in 'value'), then slots 0..count are written by one
+ *          `fwrite`. Only the used slots are written, count + 1 times 16 bytes.
+ *
+ * @param tree A pointer to an initialized tree.
+ * @param file A file opened for binary writing.
+ *
+ * @retval true The whole tree was written.
+ * @retval false A parameter is NULL or the write failed.
+ */
+bool bst_compact_save(bst_compact_t *tree, FILE *file) {
+
+    // NULL check
+    if (tree == NULL || file == NULL) {
+        return false;
+    }
+
+    bst_compact_node_t header;
+    memset(&header, 0, sizeof(header));
+    header.left = tree->root;
+    header.right = tree->count;
+    header.value = BST_COMPACT_MAGIC;
+
+    // An empty tree may have no array to hold the header
+    if (tree->nodes == NULL) {
+        return fwrite(&header, sizeof(header), 1, file) == 1;
+    }
+
+    tree->nodes[0] = header;
+    return fwrite(tree->nodes, sizeof(bst_compact_node_t), tree->count + 1, file) ==
+           tree->count + 1;
+}
+
+/**
+ * @brief Replaces the contents of the tree by a tree read from a binary file.
+ *
+ * @details Reads the header written by `bst_compact_save`, then the nodes in chunks of
+ *          BST_COMPACT_LOAD_CHUNK, growing the node array as they arrive. The node count must
+ *          not exceed BST_COMPACT_MAX_COUNT.
+ *          Then the tree is walked from the root: every child index must lie within the array,
+ *          every node must be reached exactly once and all 'count' nodes must be reached. A
+ *          damaged file therefore cannot make the tree point outside the array, share a
+ *          subtree, contain a cycle or leave unreachable nodes behind.
+ *
+ * @param tree A pointer to an initialized tree.
+ * @param file A file opened for binary reading, positioned at a saved tree.
+ *
+ * @post On failure the tree is empty.
+ *
+ * @retval true The tree was read.
+ * @retval false A parameter is NULL, the file is not a valid saved tree or an allocation
+ *               failed.
+ */
+bool bst_compact_load(bst_compact_t *tree, FILE *file) {
+
+    // NULL check
+    if (tree == NULL || file == NULL) {
+        return false;
+    }
+
+    bst_compact_dispose(tree);
+
+    bst_compact_node_t header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || header.value != BST_COMPACT_MAGIC ||
+        header.left > header.right || (header.left == BST_COMPACT_NIL) != (header.right == 0) ||
+        header.right > BST_COMPACT_MAX_COUNT) {
+        return false;
+    }
+
+    uint32_t count = header.right;
+    if (count == 0) {
+        return true;
+    }
+    // Grow with the data actually read, a short file never allocates for its header count
+    uint32_t loaded = 0;
+    while (loaded < count) {
+        uint32_t chunk = count - loaded < BST_COMPACT_LOAD_CHUNK ? count - loaded
+                                                                 : BST_COMPACT_LOAD_CHUNK;
+        if (!bst_compact_reserve(tree, loaded + chunk + 1) ||
+            fread(tree->nodes + 1 + loaded, sizeof(bst_compact_node_t), chunk, file) != chunk) {
+            bst_compact_dispose(tree);
+            return false;
+        }
+        loaded += chunk;
+    }
+
+    tree->root = header.left;
+    tree->count = count;
+    if (!bst_compact_check(tree)) {
+        bst_compact_dispose(tree);
+        return false;
+    }
+
+    tree->nodes[0] = header;
+    return true;
+}
+
+/* End of btree/bst_compact.c */
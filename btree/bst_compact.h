@@ -0,0 +1,53 @@
+/*
+ * Header file for the compact binary search tree.
+ * The nodes live in one contiguous array and refer to their children by
+ * 32-bit indices instead of pointers, so a node takes 16 bytes and the whole
+ * tree can be written to a file as it is.
+ */
+
+#ifndef IAL_BTREE_COMPACT_H
+#define IAL_BTREE_COMPACT_H
+
+#include "btree.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Index of no node; slot 0 of the array is never a tree node
+#define BST_COMPACT_NIL 0
+
+// Maximal number of nodes, keeps the slot count within 2^31
+#define BST_COMPACT_MAX_COUNT 0x7FFFFFFFu
+
+// Tag of a saved tree ("BSTC")
+#define BST_COMPACT_MAGIC 0x42535443
+
+// Tree node
+typedef struct bst_compact_node {
+  uint32_t left;  // index of the left descendant
+  uint32_t right; // index of the right descendant
+  int value;      // value
+  char key;       // key
+} bst_compact_node_t;
+
+// Tree, the nodes occupy slots 1..count
+typedef struct bst_compact {
+  bst_compact_node_t *nodes; // node array
+  uint32_t root;             // index of the root
+  uint32_t count;            // number of nodes
+  uint32_t capacity;         // number of slots, including slot 0
+} bst_compact_t;
+
+void bst_compact_init(bst_compact_t *tree);
+void bst_compact_insert(bst_compact_t *tree, char key, int value);
+bool bst_compact_search(bst_compact_t *tree, char key, int *value);
+void bst_compact_delete(bst_compact_t *tree, char key);
+void bst_compact_dispose(bst_compact_t *tree);
+
+bool bst_compact_from_tree(bst_compact_t *tree, bst_node_t *source);
+bool bst_compact_save(bst_compact_t *tree, FILE *file);
+bool bst_compact_load(bst_compact_t *tree, FILE *file);
+
+#endif
+
+/* End of btree/bst_compact.h */
@@ -0,0 +1,439 @@
+/**
+ * @file btree/bst_frozen.c
+ * @brief Binary Search Tree - Read-Only Snapshots in Eytzinger and van Emde Boas Layout
+ * @details `bst_search` on a `bst_node_t` tree loads one node per level. The address of each
+ *          load depends on the previous one, so a search through a tree that is not in the
+ *          cache costs one memory latency per level. A frozen snapshot copies the keys of the
+ *          tree into a complete binary tree. That tree is implicit: the position of a child
+ *          is computed from the position of its parent, so no pointers are stored and the
+ *          search can fetch deeper levels before it reaches them. Keys and values are kept in
+ *          separate arrays. The search reads only the keys, 64 of them per cache line, and
+ *          reads a single value at the end.
+ *
+ *          Two layouts are available:
+ *          - Eytzinger (`bst_eytzinger`): breadth-first order with slots 1..count and slot 0
+ *            unused. The children of slot k are 2k and 2k + 1. The descendants of slot k
+ *            six levels down are the 64 slots from 64k, a single cache line, so the search
+ *            prefetches that line while it works through the six levels in between.
+ *          - van Emde Boas (`bst_veb`): the tree is split at half of its height into a top
+ *            tree and the bottom trees hanging from it. The top tree is stored first, then
+ *            the bottom trees one after another, each split the same way recursively. Every
+ *            subtree of any height lies in a contiguous block, so a search touches
+ *            O(log_B n) blocks for any block size B without knowing B. The tree is padded to
+ *            a perfect one of 2^height - 1 slots by repeating the largest key. Positions are
+ *            computed with three tables indexed by level (Brodal, Fagerberg and Jacob).
+ *
+ *          Both searches find the lower bound, the first key not less than the searched one,
+ *          and descend without data-dependent branches: the comparison only selects the next
+ *          index. Then one comparison decides whether the key was found.
+ *
+ *          Key functions implemented:
+ *          - bst_frozen_init: Initializes an empty snapshot.
+ *          - bst_freeze: Builds a snapshot of a tree.
+ *          - bst_frozen_search: Searches for a key in a snapshot.
+ *          - bst_frozen_dispose: Releases a snapshot.
+ *
+ * @code
+ * bst_frozen_t frozen;
+ * bst_frozen_init(&frozen);
+ * bst_freeze(&frozen, tree, bst_eytzinger); // the tree itself is not changed
+ * int value;
+ * bst_frozen_search(&frozen, 'D', &value);
+ * bst_frozen_dispose(&frozen);
+ * @endcode
+ *
+ * @warning A snapshot does not follow later changes of the tree; freeze it again instead.
+ *
+ * @see bst_frozen.h for type definitions.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project02-2021 for the project repository.
+ */
+
+#include "bst_frozen.h"
+#include <stdlib.h>
+
+#if defined(__GNUC__)
+#define BST_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define BST_PREFETCH(address) ((void)0)
+#endif
+
+// Keys in a cache line; the Eytzinger search prefetches that many slots ahead
+#define BST_FROZEN_LINE_KEYS 64
+
+// Sorted keys and values collected from a tree
+typedef struct bst_frozen_input {
+    char *keys;   // next key to be filled in
+    int *values;  // next value to be filled in
+    int left;     // number of keys that still fit
+} bst_frozen_input_t;
+
+/**
+ * @brief Visitor counting the nodes of a tree.
+ *
+ * @param node The visited node.
+ * @param context A pointer to the counter.
+ *
+ * @return 0, the traversal continues.
+ */
+static int bst_frozen_count(bst_node_t *node, void *context) {
+    (*(int *) context)++;
+    return 0;
+}
+
+/**
+ * @brief Visitor copying the key and value of a node to the sorted input.
+ *
+ * @param node The visited node.
+ * @param context A pointer to the `bst_frozen_input_t`.
+ *
+ * @retval 0 The traversal continues.
+ * @retval 1 The input is full, the node is not copied.
+ */
+static int bst_frozen_collect(bst_node_t *node, void *context) {
+    bst_frozen_input_t *input = context;
+
+    // Never write past the arrays sized by the counting pass
+    if (input->left == 0) {
+        return 1;
+    }
+
+    input->left--;
+    *input->keys++ = node->key;
+    *input->values++ = node->value;
+    return 0;
+}
+
+/**
+ * @brief Places the sorted input into the subtree of Eytzinger slot 'slot'.
+ *
+ * @details Fills the left subtree, the slot and the right subtree, in this order, so the
+ *          slots receive the input in inorder. The depth of the recursion is the height of
+ *          the tree.
+ *
+ * @param frozen The snapshot being built.
+ * @param input The sorted input, advanced past the placed keys.
+ * @param slot The root slot of the subtree.
+ * @param size The number of slots, the subtree ends at slots greater than 'size'.
+ *
+ * @return This function does not return a value.
+ */
+static void bst_frozen_place(bst_frozen_t *frozen, bst_frozen_input_t *input, int slot,
+                             int size) {
+
+    // If the subtree is empty
+    if (slot > size) {
+        return;
+    }
+
+    bst_frozen_place(frozen, input, 2 * slot, size);
+    frozen->keys[slot] = *input->keys++;
+    frozen->values[slot] = *input->values++;
+    bst_frozen_place(frozen, input, 2 * slot + 1, size);
+}
+
+/**
+ * @brief Fills the van Emde Boas tables for a subtree and its recursive splits.
+ *
+ * @details The subtree of height 'height' rooted at level 'depth' is split into a top tree of
+ *          height / 2 levels and bottom trees of the remaining levels. For the level of the
+ *          bottom tree roots, the tables record the size of the top tree, the size of a
+ *          bottom tree and the level of the top tree root.
+ *
+ * @param frozen The snapshot being built.
+ * @param depth The level of the subtree root, 0 for the root of the tree.
+ * @param height The number of levels of the subtree.
+ *
+ * @return This function does not return a value.
+ */
+static void bst_frozen_veb_split(bst_frozen_t *frozen, int depth, int height) {
+
+    // A single level is not split
+    if (height <= 1) {
+        return;
+    }
+
+    int topHeight = height / 2;
+    int bottomHeight = height - topHeight;
+    int bottomDepth = depth + topHeight;
+
+    frozen->veb_top[bottomDepth] = (1 << topHeight) - 1;
+    frozen->veb_bottom[bottomDepth] = (1 << bottomHeight) - 1;
+    frozen->veb_depth[bottomDepth] = depth;
+
+    bst_frozen_veb_split(frozen, depth, topHeight);
+    bst_frozen_veb_split(frozen, bottomDepth, bottomHeight);
+}
+
+/**
+ * @brief Copies a subtree from breadth-first order into van Emde Boas order.
+ *
+ * @details Lays out the top tree first and then the bottom trees from left to right, the
+ *          same split as in `bst_frozen_veb_split`.
+ *
+ * @param frozen The snapshot being built.
+ * @param bfsKeys The keys in breadth-first order, 1-based.
+ * @param bfsValues The values in breadth-first order, 1-based.
+ * @param slot The breadth-first slot of the subtree root.
+ * @param height The number of levels of the subtree.
+ * @param position The next free position in the van Emde Boas arrays.
+ *
+ * @return The next free position after the subtree.
+ */
+static int bst_frozen_veb_layout(bst_frozen_t *frozen, const char *bfsKeys,
+                                 const int *bfsValues, int slot, int height, int position) {
+
+    // A single node
+    if (height == 1) {
+        frozen->keys[position] = bfsKeys[slot];
+        frozen->values[position] = bfsValues[slot];
+        return position + 1;
+    }
+
+    int topHeight = height / 2;
+    int bottomHeight = height - topHeight;
+
+    position = bst_frozen_veb_layout(frozen, bfsKeys, bfsValues, slot, topHeight, position);
+    int firstBottom = slot << topHeight;
+    for (int i = 0; i < 1 << topHeight; i++) {
+        position = bst_frozen_veb_layout(frozen, bfsKeys, bfsValues, firstBottom + i,
+                                         bottomHeight, position);
+    }
+    return position;
+}
+
+/**
+ * @brief Initializes an empty snapshot.
+ *
+ * @param frozen A pointer to the snapshot to be initialized.
+ *
+ * @return This function does not return a value.
+ */
+void bst_frozen_init(bst_frozen_t *frozen) {
+
+    // NULL check
+    if (frozen == NULL) {
+        return;
+    }
+
+    frozen->layout = bst_eytzinger;
+    frozen->keys = NULL;
+    frozen->values = NULL;
+    frozen->count = 0;
+    frozen->size = 0;
+    frozen->height = 0;
+    for (int i = 0; i < BST_FROZEN_MAX_HEIGHT; i++) {
+        frozen->veb_top[i] = 0;
+        frozen->veb_bottom[i] = 0;
+        frozen->veb_depth[i] = 0;
+    }
+}
+
+/**
+ * @brief Builds a read-only snapshot of a tree.
+ *
+ * @details Counts the nodes and collects the keys in sorted order by `bst_visit_inorder`,
+ *          then places them into a complete tree in breadth-first order. For the van Emde
+ *          Boas layout, the tree is first padded to a perfect one by repeating the largest
+ *          key, and the breadth-first arrays are reordered. The result does not depend on the
+ *          shape of the frozen tree, only on its keys.
+ *
+ * @param frozen A pointer to an initialized snapshot; its previous contents are released.
+ * @param tree The root of the tree, may be NULL.
+ * @param layout The order of the nodes in the snapshot.
+ *
+ * @post The tree is not changed. On failure the snapshot is empty.
+ *
+ * @retval true The snapshot was built.
+ * @retval false 'frozen' is NULL, an allocation failed or a traversal ran out of memory
+ *               for its stack (`BST_VISIT_NOMEM`, iter variant).
+ */
+bool bst_freeze(bst_frozen_t *frozen, bst_node_t *tree, bst_frozen_layout_t layout) {
+
+    // NULL check
+    if (frozen == NULL) {
+        return false;
+    }
+
+    bst_frozen_dispose(frozen);
+    frozen->layout = layout;
+
+    int count = 0;
+    if (bst_visit_inorder(tree, bst_frozen_count, &count) == BST_VISIT_NOMEM) {
+        return false;
+    }
+    if (count == 0) {
+        return true;
+    }
+
+    int height = 0;
+    while (height < BST_FROZEN_MAX_HEIGHT - 1 && (1 << height) - 1 < count) {
+        height++;
+    }
+
+    // Perfect tree for van Emde Boas, exactly 'count' nodes for Eytzinger
+    int size = layout == bst_veb ? (1 << height) - 1 : count;
+
+    char *sortedKeys = malloc(size * sizeof(char));
+    int *sortedValues = malloc(size * sizeof(int));
+    char *bfsKeys = malloc((size + 1) * sizeof(char));
+    int *bfsValues = malloc((size + 1) * sizeof(int));
+    if (sortedKeys == NULL || sortedValues == NULL || bfsKeys == NULL || bfsValues == NULL) {
+        free(sortedKeys);
+        free(sortedValues);
+        free(bfsKeys);
+        free(bfsValues);
+        return false;
+    }
+
+    bst_frozen_input_t input = {sortedKeys, sortedValues, count};
+    if (bst_visit_inorder(tree, bst_frozen_collect, &input) == BST_VISIT_NOMEM) {
+        free(sortedKeys);
+        free(sortedValues);
+        free(bfsKeys);
+        free(bfsValues);
+        return false;
+    }
+
+    // Repeat the largest key; the search finds the first copy of it
+    for (int i = count; i < size; i++) {
+        sortedKeys[i] = sortedKeys[count - 1];
+        sortedValues[i] = sortedValues[count - 1];
+    }
+
+    frozen->keys = bfsKeys;
+    frozen->values = bfsValues;
+    input.keys = sortedKeys;
+    input.values = sortedValues;
+    bst_frozen_place(frozen, &input, 1, size);
+    bfsKeys[0] = 0;
+    bfsValues[0] = 0;
+    free(sortedKeys);
+    free(sortedValues);
+
+    if (layout == bst_veb) {
+        frozen->keys = malloc(size * sizeof(char));
+        frozen->values = malloc(size * sizeof(int));
+        if (frozen->keys == NULL || frozen->values == NULL) {
+            free(frozen->keys);
+            free(frozen->values);
+            free(bfsKeys);
+            free(bfsValues);
+            bst_frozen_init(frozen);
+            return false;
+        }
+        bst_frozen_veb_split(frozen, 0, height);
+        bst_frozen_veb_layout(frozen, bfsKeys, bfsValues, 1, height, 0);
+        free(bfsKeys);
+        free(bfsValues);
+    }
+
+    frozen->count = count;
+    frozen->size = layout == bst_veb ? size : size + 1;
+    frozen->height = height;
+    return true;
+}
+
+/**
+ * @brief Searches for a key in a snapshot.
+ *
+ * @details Eytzinger: descends from slot 1 to 2k + (key at k < searched key) until the index
+ *          leaves the tree, prefetching the cache line of the descendants six levels down.
+ *          The right turns taken after the last left turn are then undone by shifting out the
+ *          trailing one bits and one more bit; what remains is the slot of the lower bound,
+ *          or 0 if every key is smaller.
+ *
+ *          van Emde Boas: descends through all levels of the perfect tree. The position of the
+ *          node at level d with breadth-first index i is
+ *          pos[veb_depth[d]] + veb_top[d] + (i & veb_top[d]) * veb_bottom[d], where pos holds
+ *          the positions visited on the way down. The lower bound is the last node where the
+ *          search turned left.
+ *
+ * @param frozen A pointer to a snapshot built by `bst_freeze`.
+ * @param key The key to be searched for.
+ * @param value A pointer where the value of the key is stored if it is found.
+ *
+ * @retval true The key was found and its value stored in 'value'.
+ * @retval false The key is not in the snapshot.
+ */
+bool bst_frozen_search(bst_frozen_t *frozen, char key, int *value) {
+
+    // NULL check
+    if (frozen == NULL || frozen->count == 0) {
+        return false;
+    }
+
+    const char *keys = frozen->keys;
+    int found;
+
+    if (frozen->layout == bst_eytzinger) {
+        unsigned count = frozen->count;
+        unsigned slot = 1;
+        while (slot <= count) {
+            unsigned ahead = slot * BST_FROZEN_LINE_KEYS;
+            BST_PREFETCH(keys + (ahead <= count ? ahead : 0));
+            slot = 2 * slot + (keys[slot] < key);
+        }
+#if defined(__GNUC__)
+        slot >>= __builtin_ffs((int) ~slot);
+#else
+        while (slot & 1) {
+            slot >>= 1;
+        }
+        slot >>= 1;
+#endif
+        found = slot;
+        if (found == 0) {
+            return false;
+        }
+    }
+    else {
+        int positions[BST_FROZEN_MAX_HEIGHT];
+        positions[0] = 0;
+        unsigned slot = 1;
+        found = -1;
+        for (int depth = 0; depth < frozen->height; depth++) {
+            int top = frozen->veb_top[depth];
+            int position = positions[frozen->veb_depth[depth]] + top +
+                           (int) (slot & top) * frozen->veb_bottom[depth];
+            positions[depth] = position;
+            bool right = keys[position] < key;
+            found = right ? found : position;
+            slot = 2 * slot + right;
+        }
+        if (found < 0) {
+            return false;
+        }
+    }
+
+    if (keys[found] != key) {
+        return false;
+    }
+    if (value != NULL) {
+        *value = frozen->values[found];
+    }
+    return true;
+}
+
+/**
+ * @brief Releases a snapshot, leaving an empty one.
+ *
+ * @param frozen A pointer to an initialized snapshot.
+ *
+ * @post The snapshot is empty and can be frozen again.
+ *
+ * @return This function does not return a value.
+ */
+void bst_frozen_dispose(bst_frozen_t *frozen) {
+
+    // NULL check
+    if (frozen == NULL) {
+        return;
+    }
+
+    free(frozen->keys);
+    free(frozen->values);
+    bst_frozen_init(frozen);
+}
+
+/* End of btree/bst_frozen.c */
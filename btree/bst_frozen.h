@@ -0,0 +1,44 @@
+/*
+ * Header file for read-only snapshots of the binary search tree.
+ * bst_freeze copies the keys of a tree into an implicit complete tree stored
+ * in an array, in breadth-first (Eytzinger) or van Emde Boas order. Searches
+ * on the array need no child pointers.
+ */
+
+#ifndef IAL_BTREE_FROZEN_H
+#define IAL_BTREE_FROZEN_H
+
+#include "btree.h"
+#include <stdbool.h>
+
+// Maximal number of levels of a snapshot
+#define BST_FROZEN_MAX_HEIGHT 32
+
+// Order of the nodes in the arrays
+typedef enum bst_frozen_layout {
+  bst_eytzinger, // breadth-first, children of slot k at 2k and 2k + 1
+  bst_veb        // van Emde Boas, recursive split into top and bottom trees
+} bst_frozen_layout_t;
+
+// Snapshot
+typedef struct bst_frozen {
+  bst_frozen_layout_t layout; // order of the nodes
+  char *keys;                 // keys of the nodes
+  int *values;                // values of the nodes
+  int count;                  // number of keys of the tree
+  int size;                   // number of slots in 'keys' and 'values'
+  int height;                 // number of levels
+  int veb_top[BST_FROZEN_MAX_HEIGHT];    // size of the top tree above a level
+  int veb_bottom[BST_FROZEN_MAX_HEIGHT]; // size of the bottom trees
+  int veb_depth[BST_FROZEN_MAX_HEIGHT];  // level of the top tree root
+} bst_frozen_t;
+
+void bst_frozen_init(bst_frozen_t *frozen);
+bool bst_freeze(bst_frozen_t *frozen, bst_node_t *tree,
+                bst_frozen_layout_t layout);
+bool bst_frozen_search(bst_frozen_t *frozen, char key, int *value);
+void bst_frozen_dispose(bst_frozen_t *frozen);
+
+#endif
+
+/* End of btree/bst_frozen.h */
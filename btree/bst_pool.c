@@ -0,0 +1,250 @@
+/**
+ * @file btree/bst_pool.c
+ * @brief Binary Search Tree - Node Pool Allocator
+ * @details Hands out `bst_node_t` nodes from large slabs instead of calling `malloc` for
+ *          every node. Allocation takes a node from the free list of released nodes or bumps
+ *          the index in the current slab; release pushes the node onto the free list. Both are
+ *          a few instructions, consecutive nodes lie next to each other in memory and there is
+ *          no per-node allocator header.
+ *
+ *          Slabs are kept after a reset, so refilling the pool does not call `malloc` again.
+ *          `bst_pool_reset` discards every node of the pool in O(1), which replaces
+ *          `bst_dispose` for trees built entirely from the pool.
+ *
+ *          The rec and iter variants allocate nodes through `bst_node_alloc` and release them
+ *          through `bst_node_release`. These use the pool selected by `bst_pool_use`, or
+ *          `malloc` and `free` when no pool is selected (the default).
+ *
+ *          Key functions implemented:
+ *          - bst_pool_init: Initializes an empty pool.
+ *          - bst_pool_alloc: Takes a node from the pool.
+ *          - bst_pool_release: Returns a node to the pool for reuse.
+ *          - bst_pool_reset: Returns all nodes to the pool in O(1).
+ *          - bst_pool_free: Releases all slabs.
+ *          - bst_pool_use: Selects the pool used by the tree operations.
+ *          - bst_node_alloc, bst_node_release: Allocation used by the tree operations.
+ *
+ * @code
+ * bst_pool_t pool;
+ * bst_pool_init(&pool, 0);
+ * bst_pool_use(&pool);
+ * bst_node_t *tree;
+ * bst_init(&tree);
+ * bst_insert(&tree, 'A', 1);  // node from the pool
+ * bst_delete(&tree, 'A');     // node back on the free list
+ * bst_insert(&tree, 'B', 2);  // reuses it
+ * bst_pool_reset(&pool);      // drops the whole tree at once
+ * bst_init(&tree);
+ * bst_pool_use(NULL);
+ * bst_pool_free(&pool);
+ * @endcode
+ *
+ * @warning The selected pool is global and the pool is not thread-safe. A tree must be
+ *          released the way its nodes were allocated: do not switch pools while a tree with
+ *          nodes from the previous allocator is still in use.
+ *
+ * @see bst_pool.h for type definitions.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project02-2021 for the project repository.
+ */
+
+#include "bst_pool.h"
+#include <stdlib.h>
+
+// Pool used by bst_node_alloc and bst_node_release, malloc when NULL
+static bst_pool_t *activePool = NULL;
+
+/**
+ * @brief Initializes an empty pool.
+ *
+ * @details No memory is allocated until the first `bst_pool_alloc`.
+ *
+ * @param pool A pointer to the pool to be initialized.
+ * @param slab_nodes Number of nodes in a slab, BST_POOL_SLAB_NODES when not positive.
+ *
+ * @return This function does not return a value.
+ */
+void bst_pool_init(bst_pool_t *pool, int slab_nodes) {
+
+    // NULL check
+    if (pool == NULL) {
+        return;
+    }
+
+    pool->slabs = NULL;
+    pool->current = NULL;
+    pool->used = 0;
+    pool->slab_nodes = slab_nodes > 0 ? slab_nodes : BST_POOL_SLAB_NODES;
+    pool->slab_count = 0;
+    pool->free_list = NULL;
+}
+
+/**
+ * @brief Takes a node from the pool.
+ *
+ * @details Prefers the most recently released node, which is likely still in the cache.
+ *          Otherwise the next node of the current slab is used; when the slab is full, the
+ *          next slab kept from before a reset is reused or a new one is allocated.
+ *
+ * @param pool A pointer to an initialized pool.
+ *
+ * @post The node is uninitialized; it stays valid until it is released or the pool is
+ *       reset or freed.
+ *
+ * @retval NULL 'pool' is NULL or a new slab could not be allocated.
+ * @retval non-NULL The node.
+ */
+bst_node_t *bst_pool_alloc(bst_pool_t *pool) {
+
+    // NULL check
+    if (pool == NULL) {
+        return NULL;
+    }
+
+    // Reuse a released node
+    if (pool->free_list != NULL) {
+        bst_node_t *node = pool->free_list;
+        pool->free_list = node->right;
+        return node;
+    }
+
+    // If the current slab is full (or there is none), move to the next one
+    if (pool->current == NULL || pool->used == pool->slab_nodes) {
+        bst_pool_slab_t *next = pool->current != NULL ? pool->current->next : pool->slabs;
+        if (next == NULL) {
+            next = malloc(sizeof(bst_pool_slab_t) + pool->slab_nodes * sizeof(bst_node_t));
+            if (next == NULL) {
+                return NULL;
+            }
+            next->next = NULL;
+            if (pool->current != NULL) {
+                pool->current->next = next;
+            }
+            else {
+                pool->slabs = next;
+            }
+            pool->slab_count++;
+        }
+        pool->current = next;
+        pool->used = 0;
+    }
+
+    return &pool->current->nodes[pool->used++];
+}
+
+/**
+ * @brief Returns a node to the pool for reuse.
+ *
+ * @param pool A pointer to the pool the node was taken from.
+ * @param node The node, may be NULL.
+ *
+ * @post The node must not be used anymore; its 'right' field links the free list.
+ *
+ * @return This function does not return a value.
+ */
+void bst_pool_release(bst_pool_t *pool, bst_node_t *node) {
+
+    // NULL check
+    if (pool == NULL || node == NULL) {
+        return;
+    }
+
+    node->right = pool->free_list;
+    pool->free_list = node;
+}
+
+/**
+ * @brief Returns all nodes to the pool in O(1).
+ *
+ * @details Empties the free list and rewinds to the first slab. The slabs stay allocated and
+ *          are refilled in the same order.
+ *
+ * @param pool A pointer to an initialized pool.
+ *
+ * @post All nodes taken from the pool are invalid; trees using them must be re-initialized
+ *       by `bst_init`, not disposed.
+ *
+ * @return This function does not return a value.
+ */
+void bst_pool_reset(bst_pool_t *pool) {
+
+    // NULL check
+    if (pool == NULL) {
+        return;
+    }
+
+    pool->current = NULL;
+    pool->used = 0;
+    pool->free_list = NULL;
+}
+
+/**
+ * @brief Releases all slabs of the pool.
+ *
+ * @param pool A pointer to an initialized pool.
+ *
+ * @post All nodes taken from the pool are invalid and the pool is empty. If the pool was
+ *       selected by `bst_pool_use`, the selection is cleared.
+ *
+ * @return This function does not return a value.
+ */
+void bst_pool_free(bst_pool_t *pool) {
+
+    // NULL check
+    if (pool == NULL) {
+        return;
+    }
+
+    bst_pool_slab_t *slab = pool->slabs;
+    while (slab != NULL) {
+        bst_pool_slab_t *nextSlab = slab->next;
+        free(slab);
+        slab = nextSlab;
+    }
+    if (activePool == pool) {
+        activePool = NULL;
+    }
+    bst_pool_init(pool, pool->slab_nodes);
+}
+
+/**
+ * @brief Selects the pool used by the tree operations.
+ *
+ * @param pool A pointer to an initialized pool, or NULL to go back to `malloc` and `free`.
+ *
+ * @return This function does not return a value.
+ */
+void bst_pool_use(bst_pool_t *pool) {
+    activePool = pool;
+}
+
+/**
+ * @brief Allocates a node for the tree operations.
+ *
+ * @retval NULL The allocation failed.
+ * @retval non-NULL An uninitialized node from the selected pool, or from `malloc`.
+ */
+bst_node_t *bst_node_alloc(void) {
+    if (activePool != NULL) {
+        return bst_pool_alloc(activePool);
+    }
+    return malloc(sizeof(bst_node_t));
+}
+
+/**
+ * @brief Releases a node allocated by `bst_node_alloc`.
+ *
+ * @param node The node, may be NULL.
+ *
+ * @return This function does not return a value.
+ */
+void bst_node_release(bst_node_t *node) {
+    if (activePool != NULL) {
+        bst_pool_release(activePool, node);
+    }
+    else {
+        free(node);
+    }
+}
+
+/* End of btree/bst_pool.c */
@@ -0,0 +1,44 @@
+/*
+ * Header file for the node pool of the binary search tree.
+ * Nodes are carved out of large slabs and deleted nodes are kept on a free
+ * list for reuse. While a pool is active (bst_pool_use), the rec and iter
+ * variants take their nodes from it instead of malloc.
+ */
+
+#ifndef IAL_BTREE_POOL_H
+#define IAL_BTREE_POOL_H
+
+#include "btree.h"
+
+// Default number of nodes in a slab
+#define BST_POOL_SLAB_NODES 1024
+
+// Slab, the nodes follow the header
+typedef struct bst_pool_slab {
+  struct bst_pool_slab *next; // next slab in allocation order
+  bst_node_t nodes[];         // storage for 'slab_nodes' nodes
+} bst_pool_slab_t;
+
+// Node pool
+typedef struct bst_pool {
+  bst_pool_slab_t *slabs;   // first slab
+  bst_pool_slab_t *current; // slab being filled
+  int used;                 // nodes handed out from 'current'
+  int slab_nodes;           // capacity of a slab
+  int slab_count;           // number of allocated slabs
+  bst_node_t *free_list;    // released nodes, linked through 'right'
+} bst_pool_t;
+
+void bst_pool_init(bst_pool_t *pool, int slab_nodes);
+bst_node_t *bst_pool_alloc(bst_pool_t *pool);
+void bst_pool_release(bst_pool_t *pool, bst_node_t *node);
+void bst_pool_reset(bst_pool_t *pool);
+void bst_pool_free(bst_pool_t *pool);
+
+void bst_pool_use(bst_pool_t *pool);
+bst_node_t *bst_node_alloc(void);
+void bst_node_release(bst_node_t *node);
+
+#endif
+
+/* End of btree/bst_pool.h */
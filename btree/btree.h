@@ -6,14 +6,21 @@
 #ifndef IAL_BTREE_H
 #define IAL_BTREE_H
 
+#include <limits.h>
 #include <stdbool.h>
 
-// Tree node
+// Tree node. 'red', 'height' and 'size' are used by some variants only, but
+// they are always part of the node, so the layout does not depend on the
+// CFLAGS of a translation unit. 'red' fills the padding after 'key', which
+// keeps the node at 32 bytes.
 typedef struct bst_node {
   char key;               // key
+  bool red;               // node colour (red-black variant)
   int value;              // value
   struct bst_node *left;  // left descendant
   struct bst_node *right; // right descendant
+  int height;             // height of the subtree (AVL variant)
+  int size;               // number of nodes in the subtree (rec and iter)
 } bst_node_t;
 
 void bst_init(bst_node_t **tree);
@@ -28,6 +35,28 @@ void bst_postorder(bst_node_t *tree);
 
 void bst_replace_by_rightmost(bst_node_t *target, bst_node_t **tree);
 
+// Visitor called for every node by the bst_visit_* traversals. Returning a
+// non-zero value stops the traversal, which then returns that value.
+typedef int (*bst_visitor_t)(bst_node_t *node, void *context);
+
+// Returned by the bst_visit_* traversals and bst_range when their stack cannot
+// grow (iter variant); visitors must not return it.
+#define BST_VISIT_NOMEM INT_MIN
+
+int bst_visit_preorder(bst_node_t *tree, bst_visitor_t visitor, void *context);
+int bst_visit_inorder(bst_node_t *tree, bst_visitor_t visitor, void *context);
+int bst_visit_postorder(bst_node_t *tree, bst_visitor_t visitor, void *context);
+
+int bst_range(bst_node_t *tree, char low, char high, bst_visitor_t visitor,
+              void *context);
+int bst_count_range(bst_node_t *tree, char low, char high);
+
+int bst_rank(bst_node_t *tree, char key);
+bst_node_t *bst_select(bst_node_t *tree, int k);
+
+bst_node_t *bst_build_sorted(const char keys[], const int values[], int count);
+void bst_dispose_sorted(bst_node_t **tree);
+
 void bst_print_node(bst_node_t *node);
 
 #endif
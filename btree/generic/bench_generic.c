@@ -0,0 +1,73 @@
+#include "bst_generic.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define KEY_COUNT (1 << 20)
+#define ROUNDS 3
+
+// Comparator called through a pointer, as a comparator plus key size API would
+static int compare_u64(const void *a, const void *b) {
+  uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+  return (x > y) - (x < y);
+}
+int (*volatile compare)(const void *, const void *) = compare_u64;
+#define CMP_CALLBACK(a, b) compare(&(a), &(b))
+
+BSTDEC(uint64_t, uint64_t, cb)
+BSTDEF(uint64_t, uint64_t, cb, CMP_CALLBACK)
+
+static double now_seconds() {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Keeps the compiler from dropping the lookups
+volatile uint64_t sink;
+
+// Same loop for both instantiations, TNAME selects the tree
+#define BENCH(TNAME, NAME)                                                     \
+  {                                                                            \
+    double insert = 0, search = 0;                                             \
+    for (int round = 0; round < ROUNDS; round++) {                             \
+      bst_##TNAME##_node_t *tree;                                              \
+      bst_##TNAME##_init(&tree);                                               \
+      double start = now_seconds();                                            \
+      for (int i = 0; i < KEY_COUNT; i++) {                                    \
+        bst_##TNAME##_insert(&tree, keys[i], i);                               \
+      }                                                                        \
+      insert += now_seconds() - start;                                         \
+      start = now_seconds();                                                   \
+      for (int i = 0; i < KEY_COUNT; i++) {                                    \
+        uint64_t value = 0;                                                    \
+        bst_##TNAME##_search(tree, keys[i], &value);                           \
+        sink = value;                                                          \
+      }                                                                        \
+      search += now_seconds() - start;                                         \
+      bst_##TNAME##_dispose(&tree);                                            \
+    }                                                                          \
+    printf("%-10s %10.1f %10.1f\n", NAME, insert * 1e9 / ROUNDS / KEY_COUNT,   \
+           search * 1e9 / ROUNDS / KEY_COUNT);                                 \
+  }
+
+int main(int argc, char *argv[]) {
+  uint64_t *keys = malloc(KEY_COUNT * sizeof(uint64_t));
+  if (keys == NULL) {
+    return 1;
+  }
+  srand(42);
+  for (int i = 0; i < KEY_COUNT; i++) {
+    keys[i] = ((uint64_t)rand() << 31) ^ (uint64_t)rand();
+  }
+
+  printf("%i random 64-bit keys, ns per operation\n\n", KEY_COUNT);
+  printf("%-10s %10s %10s\n", "compare", "insert", "search");
+  BENCH(u64, "numeric")
+  BENCH(cb, "callback")
+
+  free(keys);
+  return 0;
+}
+
+/* End of btree/generic/bench_generic.c */
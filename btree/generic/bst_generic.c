@@ -0,0 +1,39 @@
+/**
+ * @file btree/generic/bst_generic.c
+ * @brief Generic Binary Search Tree - Predefined Instantiations
+ * @details Generates the implementation of the trees declared at the end of
+ *          bst_generic.h. Integer keys use `BST_CMP_NUMERIC`, which the compiler
+ *          expands in place, so a search step is a compare, two flag moves and a
+ *          conditional move instead of a call through a comparator. String keys use
+ *          `strcmp` and are not copied; the caller keeps them alive while they are
+ *          in the tree.
+ *
+ *          Other key or value types are instantiated the same way in the file that
+ *          needs them:
+ *
+ * @code
+ * #include "bst_generic.h"
+ *
+ * BSTDEC(double, int, dbl)
+ * BSTDEF(double, int, dbl, BST_CMP_NUMERIC)
+ *
+ * bst_dbl_node_t *tree;
+ * bst_dbl_init(&tree);
+ * bst_dbl_insert(&tree, 2.5, 1);
+ * bst_dbl_dispose(&tree);
+ * @endcode
+ *
+ * @see bst_generic.h for the BSTDEC and BSTDEF macros.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project02-2021 for the project repository.
+ */
+
+#include "bst_generic.h"
+
+BSTDEF(int32_t, int32_t, i32, BST_CMP_NUMERIC)
+BSTDEF(uint32_t, uint32_t, u32, BST_CMP_NUMERIC)
+BSTDEF(int64_t, int64_t, i64, BST_CMP_NUMERIC)
+BSTDEF(uint64_t, uint64_t, u64, BST_CMP_NUMERIC)
+BSTDEF(const char *, void *, str, BST_CMP_STRING)
+
+/* End of btree/generic/bst_generic.c */
@@ -0,0 +1,225 @@
+/*
+ * Header file for the generic binary search tree.
+ * The tree is an AVL tree (see btree/avl/btree.c) whose key and value types
+ * are chosen at compile time by instantiating the macros below, in the same
+ * way as DSTACKDEC/DSTACKDEF in btree/iter/dstack.h.
+ */
+
+#ifndef IAL_BTREE_GENERIC_H
+#define IAL_BTREE_GENERIC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Three-way comparisons passed as CMP to BSTDEF; they return a negative
+ * number, zero or a positive number. The numeric one compiles to two setcc
+ * instructions and a subtraction, so a search step has no branch besides
+ * the loop condition and the equality test.
+ */
+#define BST_CMP_NUMERIC(a, b) (((a) > (b)) - ((a) < (b)))
+#define BST_CMP_STRING(a, b) strcmp((a), (b))
+
+/*
+ * Macro generating declarations for a tree with key type K and value type V
+ * with the name infix TNAME. For TNAME="u64", K="uint64_t", V="uint64_t":
+ *   Data type bst_u64_node_t
+ *   Functions void bst_u64_init(bst_u64_node_t **tree)
+ *             void bst_u64_insert(bst_u64_node_t **tree, uint64_t key,
+ *                                 uint64_t value)
+ *             bool bst_u64_search(bst_u64_node_t *tree, uint64_t key,
+ *                                 uint64_t *value)
+ *             void bst_u64_delete(bst_u64_node_t **tree, uint64_t key)
+ *             void bst_u64_dispose(bst_u64_node_t **tree)
+ *             int bst_u64_height(bst_u64_node_t *tree)
+ */
+#define BSTDEC(K, V, TNAME)                                                    \
+  typedef struct bst_##TNAME##_node {                                          \
+    K key;                                                                     \
+    V value;                                                                   \
+    struct bst_##TNAME##_node *left;                                           \
+    struct bst_##TNAME##_node *right;                                          \
+    int height;                                                                \
+  } bst_##TNAME##_node_t;                                                      \
+                                                                               \
+  void bst_##TNAME##_init(bst_##TNAME##_node_t **tree);                        \
+  void bst_##TNAME##_insert(bst_##TNAME##_node_t **tree, K key, V value);      \
+  bool bst_##TNAME##_search(bst_##TNAME##_node_t *tree, K key, V *value);      \
+  void bst_##TNAME##_delete(bst_##TNAME##_node_t **tree, K key);               \
+  void bst_##TNAME##_dispose(bst_##TNAME##_node_t **tree);                     \
+  int bst_##TNAME##_height(bst_##TNAME##_node_t *tree);
+
+/*
+ * Macro generating the implementation of a tree declared by BSTDEC.
+ * CMP(a, b) compares two keys, see BST_CMP_NUMERIC. Keys and values are
+ * copied into the nodes by assignment; for pointer keys (strings) the
+ * caller keeps the pointed-to data alive.
+ */
+#define BSTDEF(K, V, TNAME, CMP)                                               \
+  static int bst_##TNAME##_node_height(bst_##TNAME##_node_t *tree) {           \
+    return tree != NULL ? tree->height : 0;                                    \
+  }                                                                            \
+                                                                               \
+  static void bst_##TNAME##_update_height(bst_##TNAME##_node_t *node) {        \
+    int left_height = bst_##TNAME##_node_height(node->left);                   \
+    int right_height = bst_##TNAME##_node_height(node->right);                 \
+    node->height =                                                             \
+        (left_height > right_height ? left_height : right_height) + 1;         \
+  }                                                                            \
+                                                                               \
+  static void bst_##TNAME##_rotate_left(bst_##TNAME##_node_t **tree) {         \
+    bst_##TNAME##_node_t *root = *tree;                                        \
+    bst_##TNAME##_node_t *pivot = root->right;                                 \
+    root->right = pivot->left;                                                 \
+    pivot->left = root;                                                        \
+    bst_##TNAME##_update_height(root);                                         \
+    bst_##TNAME##_update_height(pivot);                                        \
+    *tree = pivot;                                                             \
+  }                                                                            \
+                                                                               \
+  static void bst_##TNAME##_rotate_right(bst_##TNAME##_node_t **tree) {        \
+    bst_##TNAME##_node_t *root = *tree;                                        \
+    bst_##TNAME##_node_t *pivot = root->left;                                  \
+    root->left = pivot->right;                                                 \
+    pivot->right = root;                                                       \
+    bst_##TNAME##_update_height(root);                                         \
+    bst_##TNAME##_update_height(pivot);                                        \
+    *tree = pivot;                                                             \
+  }                                                                            \
+                                                                               \
+  static void bst_##TNAME##_rebalance(bst_##TNAME##_node_t **tree) {           \
+    bst_##TNAME##_node_t *root = *tree;                                        \
+    if (root == NULL) {                                                        \
+      return;                                                                  \
+    }                                                                          \
+    bst_##TNAME##_update_height(root);                                         \
+    int balance = bst_##TNAME##_node_height(root->left) -                      \
+                  bst_##TNAME##_node_height(root->right);                      \
+    if (balance > 1) {                                                         \
+      if (bst_##TNAME##_node_height(root->left->left) <                        \
+          bst_##TNAME##_node_height(root->left->right)) {                      \
+        bst_##TNAME##_rotate_left(&root->left);                                \
+      }                                                                        \
+      bst_##TNAME##_rotate_right(tree);                                        \
+    } else if (balance < -1) {                                                 \
+      if (bst_##TNAME##_node_height(root->right->right) <                      \
+          bst_##TNAME##_node_height(root->right->left)) {                      \
+        bst_##TNAME##_rotate_right(&root->right);                              \
+      }                                                                        \
+      bst_##TNAME##_rotate_left(tree);                                         \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void bst_##TNAME##_init(bst_##TNAME##_node_t **tree) {                       \
+    if (tree != NULL) {                                                        \
+      *tree = NULL;                                                            \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  bool bst_##TNAME##_search(bst_##TNAME##_node_t *tree, K key, V *value) {     \
+    while (tree != NULL) {                                                     \
+      int cmp = CMP(key, tree->key);                                           \
+      if (cmp == 0) {                                                          \
+        *value = tree->value;                                                  \
+        return true;                                                           \
+      }                                                                        \
+      tree = cmp < 0 ? tree->left : tree->right;                               \
+    }                                                                          \
+    return false;                                                              \
+  }                                                                            \
+                                                                               \
+  void bst_##TNAME##_insert(bst_##TNAME##_node_t **tree, K key, V value) {     \
+    if (tree == NULL) {                                                        \
+      return;                                                                  \
+    }                                                                          \
+    bst_##TNAME##_node_t *root = *tree;                                        \
+    if (root == NULL) {                                                        \
+      root = malloc(sizeof(bst_##TNAME##_node_t));                             \
+      if (root == NULL) {                                                      \
+        return;                                                                \
+      }                                                                        \
+      root->key = key;                                                         \
+      root->value = value;                                                     \
+      root->left = NULL;                                                       \
+      root->right = NULL;                                                      \
+      root->height = 1;                                                        \
+      *tree = root;                                                            \
+      return;                                                                  \
+    }                                                                          \
+    int cmp = CMP(key, root->key);                                             \
+    if (cmp == 0) {                                                            \
+      root->value = value;                                                     \
+      return;                                                                  \
+    }                                                                          \
+    bst_##TNAME##_insert(cmp < 0 ? &root->left : &root->right, key, value);    \
+    bst_##TNAME##_rebalance(tree);                                             \
+  }                                                                            \
+                                                                               \
+  static void bst_##TNAME##_replace_by_rightmost(bst_##TNAME##_node_t *target, \
+                                                 bst_##TNAME##_node_t **tree) {\
+    bst_##TNAME##_node_t *root = *tree;                                        \
+    if (root->right != NULL) {                                                 \
+      bst_##TNAME##_replace_by_rightmost(target, &root->right);                \
+      bst_##TNAME##_rebalance(tree);                                           \
+    } else {                                                                   \
+      target->key = root->key;                                                 \
+      target->value = root->value;                                             \
+      *tree = root->left;                                                      \
+      free(root);                                                              \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void bst_##TNAME##_delete(bst_##TNAME##_node_t **tree, K key) {              \
+    if (tree == NULL || *tree == NULL) {                                       \
+      return;                                                                  \
+    }                                                                          \
+    bst_##TNAME##_node_t *root = *tree;                                        \
+    int cmp = CMP(key, root->key);                                             \
+    if (cmp != 0) {                                                            \
+      bst_##TNAME##_delete(cmp < 0 ? &root->left : &root->right, key);         \
+    } else if (root->left != NULL && root->right != NULL) {                    \
+      bst_##TNAME##_replace_by_rightmost(root, &root->left);                   \
+    } else {                                                                   \
+      *tree = root->left != NULL ? root->left : root->right;                   \
+      free(root);                                                              \
+      return;                                                                  \
+    }                                                                          \
+    bst_##TNAME##_rebalance(tree);                                             \
+  }                                                                            \
+                                                                               \
+  void bst_##TNAME##_dispose(bst_##TNAME##_node_t **tree) {                    \
+    if (tree == NULL) {                                                        \
+      return;                                                                  \
+    }                                                                          \
+    bst_##TNAME##_node_t *node = *tree;                                        \
+    while (node != NULL) {                                                     \
+      if (node->left != NULL) {                                                \
+        bst_##TNAME##_node_t *left_node = node->left;                          \
+        node->left = left_node->right;                                         \
+        left_node->right = node;                                               \
+        node = left_node;                                                      \
+      } else {                                                                 \
+        bst_##TNAME##_node_t *right_node = node->right;                        \
+        free(node);                                                            \
+        node = right_node;                                                     \
+      }                                                                        \
+    }                                                                          \
+    *tree = NULL;                                                              \
+  }                                                                            \
+                                                                               \
+  int bst_##TNAME##_height(bst_##TNAME##_node_t *tree) {                       \
+    return bst_##TNAME##_node_height(tree);                                    \
+  }
+
+// Predefined instantiations, implemented in bst_generic.c
+BSTDEC(int32_t, int32_t, i32)
+BSTDEC(uint32_t, uint32_t, u32)
+BSTDEC(int64_t, int64_t, i64)
+BSTDEC(uint64_t, uint64_t, u64)
+BSTDEC(const char *, void *, str)
+
+#endif
+
+/* End of btree/generic/bst_generic.h */
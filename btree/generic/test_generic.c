@@ -0,0 +1,122 @@
+#include "bst_generic.h"
+#include <inttypes.h>
+#include <stdio.h>
+
+#undef TEST
+#undef ENDTEST
+
+#define TEST(NAME, DESCRIPTION)                                                \
+  void NAME() {                                                                \
+    printf("[%s] %s\n", #NAME, DESCRIPTION);
+
+#define ENDTEST                                                                \
+  printf("\n");                                                                \
+  }
+
+#define KEY_COUNT 100000
+
+void init_test() {
+  printf("Generic Binary Search Tree - testing script\n");
+  printf("-------------------------------------------\n");
+  printf("\n");
+}
+
+// Prints whether every key in [0, count) is found with the expected value
+void check_u64(bst_u64_node_t *tree, uint64_t count, uint64_t factor) {
+  uint64_t found = 0, wrong = 0;
+  for (uint64_t key = 0; key < count; key++) {
+    uint64_t value;
+    if (bst_u64_search(tree, key, &value)) {
+      found++;
+      if (value != key * factor) {
+        wrong++;
+      }
+    }
+  }
+  printf("Found %" PRIu64 " of %" PRIu64 " keys, %" PRIu64 " wrong values\n",
+         found, count, wrong);
+}
+
+TEST(test_u64_sorted, "Insert 100000 sorted 64-bit keys")
+bst_u64_node_t *tree;
+bst_u64_init(&tree);
+for (uint64_t key = 0; key < KEY_COUNT; key++) {
+  bst_u64_insert(&tree, key, key * 2);
+}
+check_u64(tree, KEY_COUNT, 2);
+printf("Height: %i\n", bst_u64_height(tree));
+bst_u64_dispose(&tree);
+printf("Disposed: %s\n", tree == NULL ? "yes" : "no");
+ENDTEST
+
+TEST(test_u64_update, "Update all values")
+bst_u64_node_t *tree;
+bst_u64_init(&tree);
+for (uint64_t key = KEY_COUNT; key-- > 0;) {
+  bst_u64_insert(&tree, key, key);
+}
+for (uint64_t key = 0; key < KEY_COUNT; key++) {
+  bst_u64_insert(&tree, key, key * 3);
+}
+check_u64(tree, KEY_COUNT, 3);
+bst_u64_dispose(&tree);
+ENDTEST
+
+TEST(test_u64_delete, "Delete every other key")
+bst_u64_node_t *tree;
+bst_u64_init(&tree);
+for (uint64_t key = 0; key < KEY_COUNT; key++) {
+  bst_u64_insert(&tree, key, key);
+}
+for (uint64_t key = 0; key < KEY_COUNT; key += 2) {
+  bst_u64_delete(&tree, key);
+}
+bst_u64_delete(&tree, KEY_COUNT + 1);
+check_u64(tree, KEY_COUNT, 1);
+printf("Height: %i\n", bst_u64_height(tree));
+bst_u64_dispose(&tree);
+ENDTEST
+
+TEST(test_i32_negative, "Signed keys keep their order")
+bst_i32_node_t *tree;
+bst_i32_init(&tree);
+for (int32_t key = -5; key <= 5; key++) {
+  bst_i32_insert(&tree, key, -key);
+}
+int32_t value = 0;
+bool found = bst_i32_search(tree, -5, &value);
+printf("Key -5: %s, value %i\n", found ? "found" : "not found", value);
+printf("Root key: %i\n", tree->key);
+bst_i32_dispose(&tree);
+ENDTEST
+
+TEST(test_str_keys, "String keys with pointer values")
+const char *keys[] = {"Bitcoin", "Ethereum", "Tether", "Cardano", "Solana"};
+int ranks[] = {1, 2, 3, 4, 5};
+bst_str_node_t *tree;
+bst_str_init(&tree);
+for (int i = 0; i < 5; i++) {
+  bst_str_insert(&tree, keys[i], &ranks[i]);
+}
+char lookup[] = "Cardano";
+void *rank = NULL;
+bst_str_search(tree, lookup, &rank);
+printf("Cardano: %i\n", rank != NULL ? *(int *)rank : -1);
+bst_str_delete(&tree, "Tether");
+rank = NULL;
+printf("Tether after delete: %s\n",
+       bst_str_search(tree, "Tether", &rank) ? "found" : "not found");
+bst_str_dispose(&tree);
+ENDTEST
+
+int main(int argc, char *argv[]) {
+  init_test();
+
+  test_u64_sorted();
+  test_u64_update();
+  test_u64_delete();
+  test_i32_negative();
+  test_str_keys();
+}
+
+/* End of btree/generic/test_generic.c */
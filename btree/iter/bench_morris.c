@@ -0,0 +1,86 @@
+#include "../btree.h"
+#include "bst_morris.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define NODE_COUNT 10000000
+#define ROUNDS 3
+
+static double now_seconds() {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Links nodes[order[low]]..nodes[order[high - 1]] into a balanced tree,
+// 'order' decides where in the array each tree position lives
+bst_node_t *link_balanced(bst_node_t *nodes, int *order, int low, int high) {
+  if (low >= high) {
+    return NULL;
+  }
+  int middle = low + (high - low) / 2;
+  bst_node_t *node = &nodes[order[middle]];
+  node->key = 'A' + middle % 26;
+  node->value = middle;
+  node->left = link_balanced(nodes, order, low, middle);
+  node->right = link_balanced(nodes, order, middle + 1, high);
+  return node;
+}
+
+int visit_sum(bst_node_t *node, void *context) {
+  *(long long *)context += node->value;
+  return 0;
+}
+
+typedef int (*traversal_t)(bst_node_t *, bst_visitor_t, void *);
+
+void bench(const char *name, traversal_t traversal, bst_node_t *tree) {
+  long long sum = 0;
+  double start = now_seconds();
+  for (int round = 0; round < ROUNDS; round++) {
+    traversal(tree, visit_sum, &sum);
+  }
+  double seconds = (now_seconds() - start) / ROUNDS;
+  printf("  %-18s %8.2f ns/node\n", name, seconds * 1e9 / NODE_COUNT);
+}
+
+void bench_layout(const char *layout, bst_node_t *tree) {
+  printf("%s\n", layout);
+  bench("stack inorder", bst_visit_inorder, tree);
+  bench("Morris inorder", bst_morris_visit_inorder, tree);
+  bench("stack preorder", bst_visit_preorder, tree);
+  bench("Morris preorder", bst_morris_visit_preorder, tree);
+}
+
+int main(int argc, char *argv[]) {
+  bst_node_t *nodes = malloc(NODE_COUNT * sizeof(bst_node_t));
+  int *order = malloc(NODE_COUNT * sizeof(int));
+  if (nodes == NULL || order == NULL) {
+    return 1;
+  }
+
+  printf("%i nodes, balanced tree\n\n", NODE_COUNT);
+
+  // Nodes in key order, neighbours in the tree are often neighbours in memory
+  for (int i = 0; i < NODE_COUNT; i++) {
+    order[i] = i;
+  }
+  bench_layout("sequential layout", link_balanced(nodes, order, 0, NODE_COUNT));
+
+  // Nodes scattered over the array, every step is a cache miss
+  srand(42);
+  for (int i = NODE_COUNT - 1; i > 0; i--) {
+    int j = ((long long)rand() * RAND_MAX + rand()) % (i + 1);
+    int tmp = order[i];
+    order[i] = order[j];
+    order[j] = tmp;
+  }
+  bench_layout("shuffled layout", link_balanced(nodes, order, 0, NODE_COUNT));
+
+  free(order);
+  free(nodes);
+  return 0;
+}
+
+/* End of btree/iter/bench_morris.c */
@@ -0,0 +1,275 @@
+/**
+ * @file btree/iter/bst_iter.c
+ * @brief Binary Search Tree - Resumable Inorder Iterator
+ * @details Implements an external iterator that returns the nodes of a binary search tree
+ *          one at a time, in ascending key order. Unlike `bst_inorder`, which walks the whole
+ *          tree inside a single call, the iterator keeps its state in a `bst_iter_t` owned by
+ *          the caller, so the traversal can be paused after any node and resumed later, e.g.
+ *          to stream the tree in pages.
+ *
+ *          The state is the stack of nodes on the path to the next node whose left subtree has
+ *          already been returned. The stack is a `dstack_bst_t`, whose first
+ *          DSTACK_INLINE_SIZE items live inside the iterator, so iterating a tree of
+ *          moderate height allocates nothing. When the stack cannot grow, the positioning
+ *          functions return false and `bst_iter_next` returns NULL without advancing;
+ *          `bst_iter_failed` tells such a failure apart from the end of the iteration.
+ *
+ *          Key functions implemented:
+ *          - bst_iter_init: Initializes an empty iterator.
+ *          - bst_iter_begin: Positions the iterator at the smallest key.
+ *          - bst_iter_seek: Positions the iterator at the smallest key not less than a given key.
+ *          - bst_iter_next: Returns the next node and advances.
+ *          - bst_iter_peek: Returns the next node without advancing.
+ *          - bst_iter_failed: Tells whether the last step failed to grow the stack.
+ *          - bst_iter_free: Releases the heap part of the stack.
+ *
+ * @code
+ * bst_iter_t iter;
+ * bst_iter_init(&iter);
+ * bst_iter_begin(&iter, tree);
+ * bst_node_t *node;
+ * while ((node = bst_iter_next(&iter)) != NULL) {
+ *     printf("%c: %d\n", node->key, node->value);
+ * }
+ * if (bst_iter_failed(&iter)) {
+ *     // Out of memory, the iterator is still at the next node
+ * }
+ * bst_iter_free(&iter);
+ * @endcode
+ *
+ * @warning Modifying the tree invalidates all iterators over it. To continue after a
+ *          modification, seek to the key following the last returned one.
+ * @warning An iterator must not be copied or moved once initialized: the stack keeps a
+ *          pointer to its inline items, so a copy would read and write the items of the
+ *          original. To fork a traversal, seek a second iterator to the next key instead.
+ *
+ * @see bst_iter.h for the iterator type.
+ * @see dstack.h for the growable stack.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project02-2021 for the project repository.
+ */
+
+#include "bst_iter.h"
+#include <stdlib.h>
+
+/**
+ * @brief Pushes the path from a node to the leftmost node of its subtree.
+ *
+ * @param iter A pointer to the iterator.
+ * @param tree The root of the subtree, may be NULL.
+ *
+ * @post On success, the leftmost node of the subtree is on top of the stack. On failure,
+ *       the nodes pushed by this call are popped again, so the stack is unchanged.
+ *
+ * @retval true The whole path was pushed.
+ * @retval false The stack could not grow.
+ */
+static bool bst_iter_push_leftmost(bst_iter_t *iter, bst_node_t *tree) {
+    int pushed = 0;
+    while (tree != NULL) {
+        if (!dstack_bst_push(&iter->stack, tree)) {
+            while (pushed-- > 0) {
+                dstack_bst_pop(&iter->stack);
+            }
+            return false;
+        }
+        pushed++;
+        tree = tree->left;
+    }
+    return true;
+}
+
+/**
+ * @brief Initializes an empty iterator.
+ *
+ * @param iter A pointer to the iterator to be initialized.
+ *
+ * @post `bst_iter_next` returns NULL until the iterator is positioned by `bst_iter_begin`
+ *       or `bst_iter_seek`.
+ *
+ * @return This function does not return a value.
+ */
+void bst_iter_init(bst_iter_t *iter) {
+
+    // NULL check
+    if (iter == NULL) {
+        return;
+    }
+
+    dstack_bst_init(&iter->stack);
+    iter->failed = false;
+}
+
+/**
+ * @brief Positions the iterator at the smallest key of the tree.
+ *
+ * @details Any previous position is discarded, the memory of the stack is kept. An iterator
+ *          may be repositioned with `bst_iter_begin` or `bst_iter_seek` any number of times.
+ *
+ * @param iter A pointer to an initialized iterator.
+ * @param tree The root of the tree to iterate, may be NULL.
+ *
+ * @post On success, the next call to `bst_iter_next` returns the node with the smallest
+ *       key. On failure, the iterator is empty.
+ *
+ * @retval true The iterator is positioned (or 'iter' is NULL).
+ * @retval false The stack could not grow; `bst_iter_failed` returns true.
+ */
+bool bst_iter_begin(bst_iter_t *iter, bst_node_t *tree) {
+
+    // NULL check
+    if (iter == NULL) {
+        return true;
+    }
+
+    dstack_bst_clear(&iter->stack);
+    iter->failed = !bst_iter_push_leftmost(iter, tree);
+    return !iter->failed;
+}
+
+/**
+ * @brief Positions the iterator at the first node whose key is not less than 'key'.
+ *
+ * @details Descends from the root like `bst_search`. Every node with a key greater than or
+ *          equal to 'key' is pushed before moving to its left subtree, nodes with a smaller
+ *          key are skipped together with their left subtree. The node on top of the stack is
+ *          then the lower bound of 'key'. Runs in O(height of the tree).
+ *
+ * @param iter A pointer to an initialized iterator.
+ * @param tree The root of the tree to iterate, may be NULL.
+ * @param key The key to seek to.
+ *
+ * @post On success, the next call to `bst_iter_next` returns the node with the smallest key
+ *       greater than or equal to 'key', or NULL if there is none. On failure, the iterator
+ *       is empty.
+ *
+ * @code
+ * // Resume paging after the last returned key
+ * bst_iter_seek(&iter, tree, lastKey + 1);
+ * @endcode
+ *
+ * @retval true The iterator is positioned (or 'iter' is NULL).
+ * @retval false The stack could not grow; `bst_iter_failed` returns true.
+ */
+bool bst_iter_seek(bst_iter_t *iter, bst_node_t *tree, char key) {
+
+    // NULL check
+    if (iter == NULL) {
+        return true;
+    }
+
+    dstack_bst_clear(&iter->stack);
+    iter->failed = false;
+    while (tree != NULL) {
+        // The node is a candidate, smaller candidates may be on the left
+        if (key <= tree->key) {
+            // A partial path would be a wrong position
+            if (!dstack_bst_push(&iter->stack, tree)) {
+                dstack_bst_clear(&iter->stack);
+                iter->failed = true;
+                return false;
+            }
+            tree = tree->left;
+        }
+        else {// The node and its left subtree are too small
+            tree = tree->right;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Returns the next node in ascending key order and advances the iterator.
+ *
+ * @details Pops the node from the top of the stack and pushes the path to the leftmost node
+ *          of its right subtree. Each node is pushed and popped exactly once during a full
+ *          iteration, so a step costs amortized O(1).
+ *
+ *          If the stack cannot grow, the node is pushed back into the slot it was popped
+ *          from, so the iterator stays at it and a later call can retry.
+ *
+ * @param iter A pointer to the iterator.
+ *
+ * @retval NULL The iteration is finished, the stack could not grow (`bst_iter_failed`
+ *              returns true) or 'iter' is NULL.
+ * @retval non-NULL The next node.
+ */
+bst_node_t *bst_iter_next(bst_iter_t *iter) {
+
+    // NULL check
+    if (iter == NULL || dstack_bst_empty(&iter->stack)) {
+        return NULL;
+    }
+
+    bst_node_t *node = dstack_bst_pop(&iter->stack);
+    iter->failed = !bst_iter_push_leftmost(iter, node->right);
+    if (iter->failed) {
+        dstack_bst_push(&iter->stack, node);
+        return NULL;
+    }
+    return node;
+}
+
+/**
+ * @brief Returns the next node without advancing the iterator.
+ *
+ * @param iter A pointer to the iterator.
+ *
+ * @retval NULL The iteration is finished (or 'iter' is NULL).
+ * @retval non-NULL The node the next call to `bst_iter_next` will return.
+ */
+bst_node_t *bst_iter_peek(bst_iter_t *iter) {
+
+    // NULL check
+    if (iter == NULL || dstack_bst_empty(&iter->stack)) {
+        return NULL;
+    }
+
+    return dstack_bst_top(&iter->stack);
+}
+
+/**
+ * @brief Tells whether the last positioning or step failed to grow the stack.
+ *
+ * @details Distinguishes the NULL that `bst_iter_next` returns at the end of the iteration
+ *          from the one it returns when it runs out of memory.
+ *
+ * @param iter A pointer to the iterator.
+ *
+ * @retval true The last `bst_iter_begin`, `bst_iter_seek` or `bst_iter_next` failed.
+ * @retval false It succeeded, or 'iter' is NULL.
+ */
+bool bst_iter_failed(bst_iter_t *iter) {
+
+    // NULL check
+    if (iter == NULL) {
+        return false;
+    }
+
+    return iter->failed;
+}
+
+/**
+ * @brief Releases the memory held by the iterator.
+ *
+ * @details Only trees deeper than DSTACK_INLINE_SIZE make the stack allocate; freeing is
+ *          nevertheless required after every iteration that may have done so.
+ *
+ * @param iter A pointer to the iterator.
+ *
+ * @post The iterator is empty and initialized; it can be positioned again.
+ *
+ * @return This function does not return a value.
+ */
+void bst_iter_free(bst_iter_t *iter) {
+
+    // NULL check
+    if (iter == NULL) {
+        return;
+    }
+
+    dstack_bst_free(&iter->stack);
+    iter->failed = false;
+}
+
+/* End of btree/iter/bst_iter.c */
@@ -0,0 +1,31 @@
+/*
+ * Header file for the resumable inorder iterator over a binary search tree.
+ * The iterator holds the path to the next node on a growable stack whose
+ * first items are stored inside the iterator itself.
+ */
+#ifndef IAL_BTREE_ITER_BST_ITER_H
+#define IAL_BTREE_ITER_BST_ITER_H
+
+#include "../btree.h"
+#include "dstack.h"
+
+// Inorder iterator, valid while the tree is not modified. The stack points at
+// its own inline items, so an iterator must not be copied or moved (assigned,
+// passed by value, memcpy'd); pass a pointer and position a second iterator
+// with bst_iter_seek to fork the traversal.
+typedef struct bst_iter {
+  dstack_bst_t stack; // nodes whose left subtree is done, next node on top
+  bool failed;        // the last begin, seek or next could not grow the stack
+} bst_iter_t;
+
+void bst_iter_init(bst_iter_t *iter);
+bool bst_iter_begin(bst_iter_t *iter, bst_node_t *tree);
+bool bst_iter_seek(bst_iter_t *iter, bst_node_t *tree, char key);
+bst_node_t *bst_iter_next(bst_iter_t *iter);
+bst_node_t *bst_iter_peek(bst_iter_t *iter);
+bool bst_iter_failed(bst_iter_t *iter);
+void bst_iter_free(bst_iter_t *iter);
+
+#endif
+
+/* End of btree/iter/bst_iter.h */
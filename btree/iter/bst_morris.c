@@ -0,0 +1,196 @@
+/**
+ * @file btree/iter/bst_morris.c
+ * @brief Binary Search Tree - Morris Traversals
+ * @details Implements inorder and preorder traversals that use O(1) extra memory: no stack,
+ *          no recursion and no allocation. Before descending into the left subtree of a node,
+ *          the traversal finds the node's inorder predecessor (the rightmost node of the left
+ *          subtree) and points its empty right link back to the node. When the traversal later
+ *          arrives at the predecessor, the link leads back up instead of a popped stack entry,
+ *          and the second arrival at the node removes the link again.
+ *
+ *          Every edge is walked at most three times, so the traversals run in O(n) like the
+ *          stack-based ones, but they touch the nodes more often. They pay off when the tree
+ *          is very deep or memory for the stack is not available.
+ *
+ *          Key functions implemented:
+ *          - bst_morris_inorder: Prints the nodes in inorder.
+ *          - bst_morris_preorder: Prints the nodes in preorder.
+ *          - bst_morris_visit_inorder: Calls a visitor for the nodes in inorder.
+ *          - bst_morris_visit_preorder: Calls a visitor for the nodes in preorder.
+ *
+ * @warning The tree is modified during the traversal and fully restored only when it returns.
+ *          The visitor must not modify or search the tree, and no other traversal may run on
+ *          the same tree at the same time.
+ *
+ * @see bst_morris.h for the prototypes.
+ * @see btree.c for the stack-based traversals.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project02-2021 for the project repository.
+ */
+
+#include "bst_morris.h"
+#include <stdlib.h>
+
+/**
+ * @brief Finds the inorder predecessor of a node within its left subtree.
+ *
+ * @details Walks the right spine of the left subtree, stopping at a missing link or at a
+ *          link already threaded back to 'node'.
+ *
+ * @param node A node with a non-empty left subtree.
+ *
+ * @return The rightmost node of the left subtree of 'node'.
+ */
+static bst_node_t *bst_morris_predecessor(bst_node_t *node) {
+    bst_node_t *predecessor = node->left;
+    while (predecessor->right != NULL && predecessor->right != node) {
+        predecessor = predecessor->right;
+    }
+    return predecessor;
+}
+
+/**
+ * @brief Visitor printing the node, used by the printing traversals.
+ *
+ * @param node The visited node.
+ * @param context Unused.
+ *
+ * @retval 0 Always, the traversal continues.
+ */
+static int bst_morris_print(bst_node_t *node, void *context) {
+    bst_print_node(node);
+    return 0;
+}
+
+/**
+ * @brief Traverses the tree in inorder without a stack and calls a visitor for each node.
+ *
+ * @details A node without a left subtree is visited and the traversal moves right, possibly
+ *          along a thread. For a node with a left subtree, the first arrival threads the
+ *          predecessor to the node and moves left; the second arrival (through the thread)
+ *          removes the thread, visits the node and moves right.
+ *
+ *          When the visitor returns non-zero, no more nodes are visited, but the walk continues
+ *          to the end so that all threads are removed. Stopping early therefore saves the visits,
+ *          not the walk.
+ *
+ * @param tree The root node of the binary search tree to traverse.
+ * @param visitor Function called for each visited node.
+ * @param context Caller data passed unchanged to every 'visitor' call.
+ *
+ * @pre 'visitor' must not be NULL and must not access the tree other than through 'node'
+ *      (its left and right links may be threads).
+ *
+ * @post The tree is unchanged.
+ *
+ * @retval 0 All nodes were visited.
+ * @retval non-zero The value returned by the visitor that stopped the traversal.
+ */
+int bst_morris_visit_inorder(bst_node_t *tree, bst_visitor_t visitor, void *context) {
+    int result = 0;
+    bst_node_t *node = tree;
+
+    while (node != NULL) {
+        // No left subtree, visit and go right (maybe along a thread)
+        if (node->left == NULL) {
+            if (result == 0) {
+                result = visitor(node, context);
+            }
+            node = node->right;
+            continue;
+        }
+
+        bst_node_t *predecessor = bst_morris_predecessor(node);
+        // First arrival, thread the predecessor back to the node and go left
+        if (predecessor->right == NULL) {
+            predecessor->right = node;
+            node = node->left;
+        }
+        else {// Second arrival, the left subtree is done
+            predecessor->right = NULL;
+            if (result == 0) {
+                result = visitor(node, context);
+            }
+            node = node->right;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Traverses the tree in preorder without a stack and calls a visitor for each node.
+ *
+ * @details Same walk as `bst_morris_visit_inorder`, but a node with a left subtree is visited
+ *          on the first arrival, when the thread is created, instead of on the second one.
+ *          When the visitor returns non-zero, the walk continues without visiting to remove
+ *          the threads.
+ *
+ * @param tree The root node of the binary search tree to traverse.
+ * @param visitor Function called for each visited node.
+ * @param context Caller data passed unchanged to every 'visitor' call.
+ *
+ * @pre 'visitor' must not be NULL and must not access the tree other than through 'node'.
+ *
+ * @post The tree is unchanged.
+ *
+ * @retval 0 All nodes were visited.
+ * @retval non-zero The value returned by the visitor that stopped the traversal.
+ */
+int bst_morris_visit_preorder(bst_node_t *tree, bst_visitor_t visitor, void *context) {
+    int result = 0;
+    bst_node_t *node = tree;
+
+    while (node != NULL) {
+        // No left subtree, visit and go right (maybe along a thread)
+        if (node->left == NULL) {
+            if (result == 0) {
+                result = visitor(node, context);
+            }
+            node = node->right;
+            continue;
+        }
+
+        bst_node_t *predecessor = bst_morris_predecessor(node);
+        // First arrival, visit, thread the predecessor back to the node and go left
+        if (predecessor->right == NULL) {
+            if (result == 0) {
+                result = visitor(node, context);
+            }
+            predecessor->right = node;
+            node = node->left;
+        }
+        else {// Second arrival, remove the thread and go right
+            predecessor->right = NULL;
+            node = node->right;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Prints the nodes in inorder without a stack.
+ *
+ * @details Drop-in replacement for `bst_inorder` that needs no memory for a stack.
+ *
+ * @param tree The root node of the binary search tree to traverse.
+ *
+ * @return This function does not return a value.
+ */
+void bst_morris_inorder(bst_node_t *tree) {
+    bst_morris_visit_inorder(tree, bst_morris_print, NULL);
+}
+
+/**
+ * @brief Prints the nodes in preorder without a stack.
+ *
+ * @details Drop-in replacement for `bst_preorder` that needs no memory for a stack.
+ *
+ * @param tree The root node of the binary search tree to traverse.
+ *
+ * @return This function does not return a value.
+ */
+void bst_morris_preorder(bst_node_t *tree) {
+    bst_morris_visit_preorder(tree, bst_morris_print, NULL);
+}
+
+/* End of btree/iter/bst_morris.c */
@@ -0,0 +1,22 @@
+/*
+ * Header file for the Morris (threaded) traversals of a binary search tree.
+ * The traversals need no stack and no allocation; they temporarily point
+ * empty right links back to the inorder successor and restore them before
+ * returning.
+ */
+#ifndef IAL_BTREE_ITER_BST_MORRIS_H
+#define IAL_BTREE_ITER_BST_MORRIS_H
+
+#include "../btree.h"
+
+void bst_morris_inorder(bst_node_t *tree);
+void bst_morris_preorder(bst_node_t *tree);
+
+int bst_morris_visit_inorder(bst_node_t *tree, bst_visitor_t visitor,
+                             void *context);
+int bst_morris_visit_preorder(bst_node_t *tree, bst_visitor_t visitor,
+                              void *context);
+
+#endif
+
+/* End of btree/iter/bst_morris.h */
@@ -14,6 +14,12 @@
  *          - bst_inorder: Iteratively performs an inorder traversal of the BST.
  *          - bst_postorder: Iteratively performs a postorder traversal of the BST.
  *          - bst_replace_by_rightmost: Replaces a node with the rightmost node of a subtree.
+ *          - bst_visit_preorder, bst_visit_inorder, bst_visit_postorder: Iterative traversals
+ *            calling a user-supplied visitor with early exit.
+ *          - bst_range: Visits the nodes with keys in a range, pruning the other subtrees.
+ *          - bst_count_range: Counts the keys in a range using the subtree sizes.
+ *          - bst_rank: Returns the number of keys smaller than a key.
+ *          - bst_select: Returns the node with the k-th smallest key.
  *          - bst_print_node: Prints the key and value of a BST node.
  * 
  *          Each function is documented to detail its operation, usage, and any
@@ -37,7 +43,7 @@
  * @endcode
  * 
  * @see btree.h for BST structure and function prototypes.
- * @see stack.h and stack.c for stack operations used in this iterative BST implementation.
+ * @see dstack.h and dstack.c for the growable stacks used in this iterative BST implementation.
  * 
  * @see https://github.com/Jekwwer/IAL-Project02-2021 for the project repository and additional documentation.
  * 
@@ -47,7 +53,8 @@
  */
 
 #include "../btree.h"
-#include "stack.h"
+#include "../bst_pool.h"
+#include "dstack.h"
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -215,7 +222,7 @@ void bst_insert(bst_node_t **tree, char key, int value) {
             }
         }
         else {// If current node is empty/key was not found
-            bst_node_t *newNode = malloc(sizeof(bst_node_t));
+            bst_node_t *newNode = bst_node_alloc();
             if (newNode == NULL) {
                 return;
             }
@@ -224,6 +231,7 @@ void bst_insert(bst_node_t **tree, char key, int value) {
             newNode->left = NULL;
             newNode->right = NULL;
             newNode->value = value;
+            newNode->size = 1;
 
             // If tree is empty
             if (prevRootPtr == rootPtr) {
@@ -237,6 +245,12 @@ void bst_insert(bst_node_t **tree, char key, int value) {
                     prevRootPtr->right = newNode;
                 }
             }
+
+            // The subtrees on the path to the new node have grown
+            for (rootPtr = *tree; rootPtr != newNode;
+                 rootPtr = key < rootPtr->key ? rootPtr->left : rootPtr->right) {
+                rootPtr->size++;
+            }
             isDone = true;
         }
     }
@@ -351,6 +365,8 @@ void bst_delete(bst_node_t **tree, char key) {
     else {// Key is in the tree
         // looking for the node with the searched key
         while (rootPtr->key != key) {
+            // The subtree loses the deleted node
+            rootPtr->size--;
             prevRootPtr = rootPtr;
             if (key < rootPtr->key) {
                 rootPtr = rootPtr->left;
@@ -410,13 +426,15 @@ void bst_delete(bst_node_t **tree, char key) {
         }
     }
     else {// Has both descendants
+        // The node stays, its left subtree loses the rightmost node
+        rootPtr->size--;
         bst_replace_by_rightmost(rootPtr, &(rootPtr->left));
         // Release the cancelled node bst_replace_by_rigthmost()
         return;
     }
 
     // Releasing memory
-    free(rootPtr);
+    bst_node_release(rootPtr);
 }
 
 /**
@@ -444,8 +462,8 @@ void bst_delete(bst_node_t **tree, char key) {
  * 
  * @todo Consider enhancing the function to handle NULL 'tree' pointers more gracefully.
  * 
- * @warning The function assumes that the provided stack operations are correctly implemented.
- *          Failure to properly use the stack can lead to incomplete tree disposal and memory leaks.
+ * @warning If the stack cannot grow, the right subtree of a node is not stored; the left child
+ *          is rotated up instead, so the whole tree is still released.
  * 
  * @return This function does not return a value.
  */
@@ -456,39 +474,50 @@ void bst_dispose(bst_node_t **tree) {
         return;
     }
 
-    // Allocate and initialize the stack for nodes
-    stack_bst_t *stack = malloc(sizeof(stack_bst_t));
-    stack_bst_init(stack);
+    // Initialize the stack for nodes
+    dstack_bst_t stackData;
+    dstack_bst_t *stack = &stackData;
+    dstack_bst_init(stack);
 
     // Current node of the tree
     bst_node_t *rootPtr = *tree;
+    // Whether the stack could grow so far
+    bool stackUsable = true;
 
     // While the subtree root is not empty or the stack is not empty
-    while (rootPtr != NULL || !stack_bst_empty(stack)) {
+    while (rootPtr != NULL || !dstack_bst_empty(stack)) {
         // If the root is empty
         if (rootPtr == NULL) {
-            if (!stack_bst_empty(stack)) {
+            if (!dstack_bst_empty(stack)) {
                 // Get the new root from the stack
-                rootPtr = stack_bst_top(stack);
-                stack_bst_pop(stack);
+                rootPtr = dstack_bst_top(stack);
+                dstack_bst_pop(stack);
             }
         }
         else {// Root is not empty
-            // If it has a right child, store it in the stack
-            if (rootPtr->right != NULL) {
-                stack_bst_push(stack, rootPtr->right);
+            // If it has both children and the right one cannot be stored in the stack,
+            // rotate the left child up instead; the root then has one child less to go.
+            // After the first failure, the stack is not tried again.
+            if (rootPtr->left != NULL && rootPtr->right != NULL &&
+                (!stackUsable || !dstack_bst_push(stack, rootPtr->right))) {
+                stackUsable = false;
+                bst_node_t *leftPtr = rootPtr->left;
+                rootPtr->left = leftPtr->right;
+                leftPtr->right = rootPtr;
+                rootPtr = leftPtr;
+                continue;
             }
-            // Go left and also release the root
+            // Go left (or right if there is no left child) and release the root
             bst_node_t *tmpPtr = rootPtr;
-            rootPtr = rootPtr->left;
-            free(tmpPtr);
+            rootPtr = rootPtr->left != NULL ? rootPtr->left : rootPtr->right;
+            bst_node_release(tmpPtr);
         }
     }
     // NULLify the tree root reference
     *tree = NULL;
 
     // Free the memory for the stack
-    free(stack);
+    dstack_bst_free(stack);
 }
 
 /**
@@ -513,30 +542,31 @@ void bst_dispose(bst_node_t **tree) {
  * 
  * @code
  * // Usage within an iterative preorder traversal function
- * stack_bst_t *to_visit = ...; // assume stack is already created and initialized
+ * dstack_bst_t *to_visit = ...; // assume stack is already created and initialized
  * bst_node_t *tree = ...; // assume tree is previously populated
  * bst_leftmost_preorder(tree, to_visit);
  * // Continue with preorder traversal...
  * @endcode
  * 
- * @todo Update the function to handle memory allocation failures more gracefully, potentially
- *       by returning an error code.
- * 
  * @warning This function assumes the existence of `bst_print_node` for printing node values
  *          and that the `to_visit` stack is properly managed externally.
  * 
- * @return This function does not return a value.
+ * @retval true The whole leftmost branch was visited and stored.
+ * @retval false The stack could not grow; the node that did not fit was not printed.
  */
-void bst_leftmost_preorder(bst_node_t *tree, stack_bst_t *to_visit) {
+bool bst_leftmost_preorder(bst_node_t *tree, dstack_bst_t *to_visit) {
     // While the subtree is not empty
     while (tree != NULL) {
         // Store the root in the stack
-        stack_bst_push(to_visit, tree);
+        if (!dstack_bst_push(to_visit, tree)) {
+            return false;
+        }
         // Print the root value
         bst_print_node(tree);
         // Go left
         tree = tree->left;
     }
+    return true;
 }
 
 /**
@@ -560,36 +590,32 @@ void bst_leftmost_preorder(bst_node_t *tree, stack_bst_t *to_visit) {
  * bst_preorder(tree); // Performs the preorder traversal of the tree
  * @endcode
  * 
- * @todo Update the function to handle memory allocation failures more gracefully, potentially
- *       by returning an error code.
- * 
  * @warning Assumes that `bst_print_node` and `bst_leftmost_preorder` are correctly implemented.
- *          Failure in memory allocation for the stack will result in early termination of the function.
+ *          The stack lives on the call stack and grows on the heap only for trees deeper than
+ *          DSTACK_INLINE_SIZE; if growing fails, a warning is printed and the traversal stops.
  * 
  * @return This function does not return a value.
  */
 void bst_preorder(bst_node_t *tree) {
-    // Allocate and initialize the stack
-    stack_bst_t *stack = malloc(sizeof(stack_bst_t));
-    if (stack == NULL) {
-        return;
-    }
-    stack_bst_init(stack);
+    // Initialize the stack
+    dstack_bst_t stackData;
+    dstack_bst_t *stack = &stackData;
+    dstack_bst_init(stack);
 
     // Go as left as possible
-    bst_leftmost_preorder(tree, stack);
+    bool complete = bst_leftmost_preorder(tree, stack);
 
-    // While the stack is not empty
-    while (!stack_bst_empty(stack)) {
+    // While the stack is not empty and it could grow so far
+    while (complete && !dstack_bst_empty(stack)) {
         // Get a node from it
-        bst_node_t *tmpRoot = stack_bst_top(stack);
-        stack_bst_pop(stack);
+        bst_node_t *tmpRoot = dstack_bst_top(stack);
+        dstack_bst_pop(stack);
         // Root and left child are already processed, go right
-        bst_leftmost_preorder(tmpRoot->right, stack);
+        complete = bst_leftmost_preorder(tmpRoot->right, stack);
     }
 
     // Free the memory for the stack
-    free(stack);
+    dstack_bst_free(stack);
 }
 
 /**
@@ -613,29 +639,30 @@ void bst_preorder(bst_node_t *tree) {
  * 
  * @code
  * // Usage within an iterative inorder traversal function
- * stack_bst_t *to_visit = ...; // assume stack is already created and initialized
+ * dstack_bst_t *to_visit = ...; // assume stack is already created and initialized
  * bst_node_t *tree = ...; // assume tree is previously populated
  * bst_leftmost_inorder(tree, to_visit);
  * // Continue with inorder traversal...
  * @endcode
  * 
- * @todo Update the function to handle memory allocation failures more gracefully, potentially
- *       by returning an error code.
- * 
  * @warning It is assumed that 'to_visit' is a properly initialized stack. Using this function without
  *          a valid 'to_visit' stack or outside of an inorder traversal routine may lead to undefined behavior.
  * 
- * @return This function does not return a value.
+ * @retval true The whole leftmost branch was stored.
+ * @retval false The stack could not grow; the branch is stored only partially.
  */
-void bst_leftmost_inorder(bst_node_t *tree, stack_bst_t *to_visit) {
+bool bst_leftmost_inorder(bst_node_t *tree, dstack_bst_t *to_visit) {
 
     // While the subtree is not empty
     while (tree != NULL) {
         // Store the root in the stack
-        stack_bst_push(to_visit, tree);
+        if (!dstack_bst_push(to_visit, tree)) {
+            return false;
+        }
         // Go left
         tree = tree->left;
     }
+    return true;
 }
 
 /**
@@ -659,38 +686,34 @@ void bst_leftmost_inorder(bst_node_t *tree, stack_bst_t *to_visit) {
  * bst_inorder(tree); // Performs the inorder traversal of the tree
  * @endcode
  * 
- * @todo Update the function to handle memory allocation failures for the stack more gracefully,
- *       potentially by returning an error code.
- * 
  * @warning Assumes that `bst_print_node` and `bst_leftmost_inorder` are correctly implemented.
- *          Failure in memory allocation for the stack will result in early termination of the function.
+ *          The stack lives on the call stack and grows on the heap only for trees deeper than
+ *          DSTACK_INLINE_SIZE; if growing fails, a warning is printed and the traversal stops.
  * 
  * @return This function does not return a value.
  */
 void bst_inorder(bst_node_t *tree) {
-    // Allocate and initialize the stack
-    stack_bst_t *stack = malloc(sizeof(stack_bst_t));
-    if (stack == NULL) {
-        return;
-    }
-    stack_bst_init(stack);
+    // Initialize the stack
+    dstack_bst_t stackData;
+    dstack_bst_t *stack = &stackData;
+    dstack_bst_init(stack);
 
     // Go as left as possible
-    bst_leftmost_inorder(tree, stack);
+    bool complete = bst_leftmost_inorder(tree, stack);
 
-    // While the stack is not empty
-    while (!stack_bst_empty(stack)) {
+    // While the stack is not empty and it could grow so far
+    while (complete && !dstack_bst_empty(stack)) {
         // Get a node from it
-        tree = stack_bst_top(stack);
-        stack_bst_pop(stack);
+        tree = dstack_bst_top(stack);
+        dstack_bst_pop(stack);
         // Print the node
         bst_print_node(tree);
         // Go right
-        bst_leftmost_inorder(tree->right, stack);
+        complete = bst_leftmost_inorder(tree->right, stack);
     }
 
-    // Free the memory for the stac
-    free(stack);
+    // Free the memory for the stack
+    dstack_bst_free(stack);
 }
 
 /**
@@ -716,8 +739,8 @@ void bst_inorder(bst_node_t *tree) {
  * 
  * @code
  * // Usage within an iterative postorder traversal function
- * stack_bst_t *to_visit = ...; // assume node stack is already created and initialized
- * stack_bool_t *first_visit = ...; // assume boolean stack is already created and initialized
+ * dstack_bst_t *to_visit = ...; // assume node stack is already created and initialized
+ * dstack_bool_t *first_visit = ...; // assume boolean stack is already created and initialized
  * bst_node_t *tree = ...; // assume tree is previously populated
  * bst_leftmost_postorder(tree, to_visit, first_visit);
  * // Continue with postorder traversal...
@@ -727,20 +750,29 @@ void bst_inorder(bst_node_t *tree) {
  *          properly initialized boolean stack. Using this function without valid 'to_visit' and 'first_visit'
  *          stacks or outside of a postorder traversal routine may lead to undefined behavior.
  * 
- * @return This function does not return a value.
+ * @retval true The whole leftmost branch was stored.
+ * @retval false One of the stacks could not grow; both stacks still hold the same number of
+ *               items, the node that did not fit is in neither.
  */
-void bst_leftmost_postorder(bst_node_t *tree, stack_bst_t *to_visit,
-                            stack_bool_t *first_visit) {
+bool bst_leftmost_postorder(bst_node_t *tree, dstack_bst_t *to_visit,
+                            dstack_bool_t *first_visit) {
 
     // While the subtree is not empty
     while (tree != NULL) {
         // Store the node in the stack
-        stack_bst_push(to_visit, tree);
+        if (!dstack_bst_push(to_visit, tree)) {
+            return false;
+        }
         // Store true, indicating we've visited the node for the first time
-        stack_bool_push(first_visit, true);
+        if (!dstack_bool_push(first_visit, true)) {
+            // Keep the two stacks in step
+            dstack_bst_pop(to_visit);
+            return false;
+        }
         // Go left
         tree = tree->left;
     }
+    return true;
 }
 
 /**
@@ -765,55 +797,402 @@ void bst_leftmost_postorder(bst_node_t *tree, stack_bst_t *to_visit,
  * bst_postorder(tree); // Performs the postorder traversal of the tree
  * @endcode
  * 
- * @todo Address potential memory allocation failures for both stacks with proper error handling.
- * 
- * @warning Assumes successful memory allocation for the node and boolean stacks. If allocation
- *          fails, the traversal is aborted prematurely.
+ * @warning The stacks grow on the heap for trees deeper than DSTACK_INLINE_SIZE. If growing
+ *          fails, a warning is printed and the traversal stops.
  * 
  * @return This function does not return a value.
  */
 void bst_postorder(bst_node_t *tree) {
-    // Allocate and initialize the node stack
-    stack_bst_t *node_stack = malloc(sizeof(stack_bst_t));
-    if (node_stack == NULL) {
-        return;
-    }
+    // Initialize the node stack
+    dstack_bst_t nodeStackData;
+    dstack_bst_t *node_stack = &nodeStackData;
+    dstack_bst_init(node_stack);
 
-    // Allocate and initialize the boolean stack
-    stack_bst_init(node_stack);
-    stack_bool_t *bool_stack = malloc(sizeof(stack_bool_t));
-    if (bool_stack == NULL) {
-        return;
-    }
-    stack_bool_init(bool_stack);
+    // Initialize the boolean stack
+    dstack_bool_t boolStackData;
+    dstack_bool_t *bool_stack = &boolStackData;
+    dstack_bool_init(bool_stack);
 
     bool isFromLeft;
 
     // Go as left as possible
-    bst_leftmost_postorder(tree, node_stack, bool_stack);
+    bool complete = bst_leftmost_postorder(tree, node_stack, bool_stack);
 
-    // While the node stack is not empty
-    while (!stack_bst_empty(node_stack)) {
+    // While the node stack is not empty and the stacks could grow so far
+    while (complete && !dstack_bst_empty(node_stack)) {
         // Check the node on top
-        tree = stack_bst_top(node_stack);
-        isFromLeft = stack_bool_top(bool_stack);
-        stack_bool_pop(bool_stack);
+        tree = dstack_bst_top(node_stack);
+        isFromLeft = dstack_bool_top(bool_stack);
+        dstack_bool_pop(bool_stack);
         // Were we on the left?
         if (isFromLeft) {
-            // We're supposed to go to the right
-            stack_bool_push(bool_stack, false);
-            bst_leftmost_postorder(tree->right, node_stack, bool_stack);
+            // We're supposed to go to the right; the flag takes the place of the popped one
+            dstack_bool_push(bool_stack, false);
+            complete = bst_leftmost_postorder(tree->right, node_stack, bool_stack);
         }
         else {// We were already on the right
             // Remove the node from the stack and write it out
-            stack_bst_pop(node_stack);
+            dstack_bst_pop(node_stack);
             bst_print_node(tree);
         }
     }
 
     // Free the memory for the stack
-    free(node_stack);
-    free(bool_stack);
+    dstack_bst_free(node_stack);
+    dstack_bool_free(bool_stack);
+}
+
+/**
+ * @brief Iteratively traverses the tree in preorder and calls a visitor for each node.
+ *
+ * @details Same order as `bst_preorder`, but every node is passed to 'visitor' together with
+ *          'context' instead of being printed, so the nodes can be aggregated, serialized or
+ *          filtered without stdio. The nodes still to be visited are kept on a growable stack;
+ *          the right descendant is pushed before the left one, so the left subtree is finished
+ *          first. A non-zero return value of the visitor stops the traversal immediately.
+ *
+ * @param tree The root node of the binary search tree to traverse.
+ * @param visitor Function called for each visited node.
+ * @param context Caller data passed unchanged to every 'visitor' call.
+ *
+ * @pre 'visitor' must not be NULL. The visitor must not modify the structure of the tree.
+ *
+ * @post The visitor was called for the nodes in preorder, up to the one that stopped the traversal.
+ *
+ * @code
+ * int sum_values(bst_node_t *node, void *context) {
+ *     *(long *) context += node->value;
+ *     return 0;
+ * }
+ * long sum = 0;
+ * bst_visit_preorder(tree, sum_values, &sum);
+ * @endcode
+ *
+ * @retval 0 All nodes were visited.
+ * @retval BST_VISIT_NOMEM The stack could not grow; the traversal stopped.
+ * @retval other The value returned by the visitor that stopped the traversal.
+ */
+int bst_visit_preorder(bst_node_t *tree, bst_visitor_t visitor, void *context) {
+    // Initialize the stack
+    dstack_bst_t stackData;
+    dstack_bst_t *stack = &stackData;
+    dstack_bst_init(stack);
+
+    int result = 0;
+    if (tree != NULL && !dstack_bst_push(stack, tree)) {
+        result = BST_VISIT_NOMEM;
+    }
+
+    // While there are nodes to visit and the visitor did not stop
+    while (result == 0 && !dstack_bst_empty(stack)) {
+        tree = dstack_bst_pop(stack);
+        result = visitor(tree, context);
+        if (result != 0) {
+            break;
+        }
+        // Right is pushed first, so that left is visited first
+        if ((tree->right != NULL && !dstack_bst_push(stack, tree->right)) ||
+            (tree->left != NULL && !dstack_bst_push(stack, tree->left))) {
+            result = BST_VISIT_NOMEM;
+        }
+    }
+
+    // Free the memory for the stack
+    dstack_bst_free(stack);
+    return result;
+}
+
+/**
+ * @brief Iteratively traverses the tree in inorder and calls a visitor for each node.
+ *
+ * @details Same order as `bst_inorder` (ascending keys), with the nodes passed to 'visitor'
+ *          instead of being printed. The path to the current node is kept on a growable stack.
+ *          A non-zero return value of the visitor stops the traversal.
+ *
+ * @param tree The root node of the binary search tree to traverse.
+ * @param visitor Function called for each visited node.
+ * @param context Caller data passed unchanged to every 'visitor' call.
+ *
+ * @pre 'visitor' must not be NULL. The visitor must not modify the structure of the tree.
+ *
+ * @post The visitor was called for the nodes in inorder, up to the one that stopped the traversal.
+ *
+ * @retval 0 All nodes were visited.
+ * @retval BST_VISIT_NOMEM The stack could not grow; the traversal stopped.
+ * @retval other The value returned by the visitor that stopped the traversal.
+ */
+int bst_visit_inorder(bst_node_t *tree, bst_visitor_t visitor, void *context) {
+    // Initialize the stack
+    dstack_bst_t stackData;
+    dstack_bst_t *stack = &stackData;
+    dstack_bst_init(stack);
+
+    int result = 0;
+    // While there are nodes to visit and the visitor did not stop
+    while (result == 0 && (tree != NULL || !dstack_bst_empty(stack))) {
+        // Go as left as possible
+        if (tree != NULL) {
+            if (!dstack_bst_push(stack, tree)) {
+                result = BST_VISIT_NOMEM;
+                break;
+            }
+            tree = tree->left;
+        }
+        else {// Visit the node and continue to the right
+            tree = dstack_bst_pop(stack);
+            result = visitor(tree, context);
+            tree = tree->right;
+        }
+    }
+
+    // Free the memory for the stack
+    dstack_bst_free(stack);
+    return result;
+}
+
+/**
+ * @brief Iteratively traverses the tree in postorder and calls a visitor for each node.
+ *
+ * @details Same order as `bst_postorder`, with the nodes passed to 'visitor' instead of being
+ *          printed. Only one stack is needed: a node on top of the stack is visited once its
+ *          right subtree is empty or was the last thing visited. A non-zero return value of the
+ *          visitor stops the traversal.
+ *
+ * @param tree The root node of the binary search tree to traverse.
+ * @param visitor Function called for each visited node.
+ * @param context Caller data passed unchanged to every 'visitor' call.
+ *
+ * @pre 'visitor' must not be NULL. The visitor must not modify the structure of the tree.
+ *
+ * @post The visitor was called for the nodes in postorder, up to the one that stopped the traversal.
+ *
+ * @retval 0 All nodes were visited.
+ * @retval BST_VISIT_NOMEM The stack could not grow; the traversal stopped.
+ * @retval other The value returned by the visitor that stopped the traversal.
+ */
+int bst_visit_postorder(bst_node_t *tree, bst_visitor_t visitor, void *context) {
+    // Initialize the stack
+    dstack_bst_t stackData;
+    dstack_bst_t *stack = &stackData;
+    dstack_bst_init(stack);
+
+    // Last visited node
+    bst_node_t *lastPtr = NULL;
+    int result = 0;
+    // While there are nodes to visit and the visitor did not stop
+    while (result == 0 && (tree != NULL || !dstack_bst_empty(stack))) {
+        // Go as left as possible
+        if (tree != NULL) {
+            if (!dstack_bst_push(stack, tree)) {
+                result = BST_VISIT_NOMEM;
+                break;
+            }
+            tree = tree->left;
+        }
+        else {
+            bst_node_t *topPtr = dstack_bst_top(stack);
+            // If the right subtree was not visited yet, go there
+            if (topPtr->right != NULL && topPtr->right != lastPtr) {
+                tree = topPtr->right;
+            }
+            else {// Both subtrees are done, visit the node
+                dstack_bst_pop(stack);
+                result = visitor(topPtr, context);
+                lastPtr = topPtr;
+            }
+        }
+    }
+
+    // Free the memory for the stack
+    dstack_bst_free(stack);
+    return result;
+}
+
+/**
+ * @brief Calls a visitor for every node with a key in [low, high], in ascending key order.
+ *
+ * @details Works like `bst_visit_inorder`, but the initial descent skips the nodes with keys
+ *          below 'low' together with their left subtrees (as `bst_iter_seek` does), and the
+ *          traversal ends at the first node with a key above 'high'. Only the nodes on the two
+ *          boundary paths and the reported nodes are visited, O(height + k) for k reported nodes.
+ *
+ * @param tree The root node of the binary search tree.
+ * @param low The smallest key of the range.
+ * @param high The largest key of the range.
+ * @param visitor Function called for each node in the range.
+ * @param context Caller data passed unchanged to every 'visitor' call.
+ *
+ * @pre 'visitor' must not be NULL. The visitor must not modify the structure of the tree.
+ *
+ * @code
+ * int print_visitor(bst_node_t *node, void *context) {
+ *     bst_print_node(node);
+ *     return 0;
+ * }
+ * bst_range(tree, 'C', 'F', print_visitor, NULL); // prints C, D, E and F if present
+ * @endcode
+ *
+ * @retval 0 All nodes of the range were visited (or the range is empty).
+ * @retval BST_VISIT_NOMEM The stack could not grow; the traversal stopped.
+ * @retval other The value returned by the visitor that stopped the traversal.
+ */
+int bst_range(bst_node_t *tree, char low, char high, bst_visitor_t visitor, void *context) {
+    // Initialize the stack
+    dstack_bst_t stackData;
+    dstack_bst_t *stack = &stackData;
+    dstack_bst_init(stack);
+
+    int result = 0;
+    // Push the path to the smallest key not less than 'low'
+    while (tree != NULL) {
+        if (low <= tree->key) {
+            if (!dstack_bst_push(stack, tree)) {
+                result = BST_VISIT_NOMEM;
+                break;
+            }
+            tree = tree->left;
+        }
+        else {// The node and its left subtree are below the range
+            tree = tree->right;
+        }
+    }
+
+    // While the visitor did not stop and the next node is in the range
+    while (result == 0 && !dstack_bst_empty(stack) && dstack_bst_top(stack)->key <= high) {
+        tree = dstack_bst_pop(stack);
+        result = visitor(tree, context);
+        // All keys of the right subtree are above 'low', go as left as possible
+        if (result == 0 && !bst_leftmost_inorder(tree->right, stack)) {
+            result = BST_VISIT_NOMEM;
+        }
+    }
+
+    // Free the memory for the stack
+    dstack_bst_free(stack);
+    return result;
+}
+
+/**
+ * @brief Counts the nodes whose key is less than 'key' (or equal to it, if 'inclusive').
+ *
+ * @details Follows a single path from the root. Whenever the path turns right, the node and
+ *          its whole left subtree are counted at once using the stored subtree size.
+ *
+ * @param tree The root node of the binary search tree.
+ * @param key The bound.
+ * @param inclusive Whether a node with the key equal to 'key' is counted.
+ *
+ * @return The number of nodes below the bound.
+ */
+static int bst_count_below(bst_node_t *tree, char key, bool inclusive) {
+    int count = 0;
+    while (tree != NULL) {
+        // If the node is below the bound, count it with its left subtree and go right
+        if (tree->key < key || (inclusive && tree->key == key)) {
+            count += (tree->left != NULL ? tree->left->size : 0) + 1;
+            tree = tree->right;
+        }
+        else {// Everything below the bound is on the left
+            tree = tree->left;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Counts the nodes with a key in [low, high].
+ *
+ * @details Uses the subtree sizes maintained by `bst_insert` and `bst_delete`: the result is
+ *          the number of keys not greater than 'high' minus the number of keys less than
+ *          'low'. Each of the two counts walks one root-to-leaf path, so the cost is
+ *          O(height) regardless of how many keys are in the range.
+ *
+ * @param tree The root node of the binary search tree.
+ * @param low The smallest key of the range.
+ * @param high The largest key of the range.
+ *
+ * @pre The subtree sizes are valid, i.e. the tree was only modified by `bst_insert`,
+ *      `bst_delete` and `bst_replace_by_rightmost`.
+ *
+ * @return The number of keys in the range, 0 if 'low' is greater than 'high'.
+ */
+int bst_count_range(bst_node_t *tree, char low, char high) {
+
+    // If the range is empty
+    if (high < low) {
+        return 0;
+    }
+
+    return bst_count_below(tree, high, true) - bst_count_below(tree, low, false);
+}
+
+/**
+ * @brief Returns the rank of a key, the number of keys in the tree smaller than it.
+ *
+ * @details The key itself does not have to be in the tree. Uses the subtree sizes, so the
+ *          cost is one root-to-leaf path, O(height), instead of an inorder traversal.
+ *
+ * @param tree The root node of the binary search tree.
+ * @param key The key to rank.
+ *
+ * @pre The subtree sizes are valid (see `bst_count_range`).
+ *
+ * @code
+ * // Keys A, C, E
+ * bst_rank(tree, 'A'); // 0
+ * bst_rank(tree, 'D'); // 2
+ * @endcode
+ *
+ * @return The number of keys less than 'key'.
+ */
+int bst_rank(bst_node_t *tree, char key) {
+    return bst_count_below(tree, key, false);
+}
+
+/**
+ * @brief Returns the node with the k-th smallest key, counting from 0.
+ *
+ * @details Compares 'k' with the size of the left subtree at each node: a smaller 'k' is
+ *          in the left subtree, an equal one is the node itself, and a larger one continues in
+ *          the right subtree with the left subtree and the node skipped. Inverse of `bst_rank`
+ *          for keys in the tree: `bst_select(tree, bst_rank(tree, key))` is the node of 'key'.
+ *          Runs in O(height).
+ *
+ * @param tree The root node of the binary search tree.
+ * @param k The number of keys smaller than the wanted one.
+ *
+ * @pre The subtree sizes are valid (see `bst_count_range`).
+ *
+ * @code
+ * bst_node_t *median = bst_select(tree, tree->size / 2);
+ * @endcode
+ *
+ * @retval NULL 'k' is negative or not less than the number of nodes.
+ * @retval non-NULL The node with exactly 'k' smaller keys.
+ */
+bst_node_t *bst_select(bst_node_t *tree, int k) {
+
+    // If k is out of range
+    if (tree == NULL || k < 0 || k >= tree->size) {
+        return NULL;
+    }
+
+    while (tree != NULL) {
+        int leftSize = tree->left != NULL ? tree->left->size : 0;
+        // If the key is on the left
+        if (k < leftSize) {
+            tree = tree->left;
+        }
+        // If the node is the k-th one
+        else if (k == leftSize) {
+            return tree;
+        }
+        else {// The key is on the right, skip the left subtree and the node
+            k -= leftSize + 1;
+            tree = tree->right;
+        }
+    }
+    return NULL;
 }
 
 /* End of btree/iter/btree.c */
@@ -0,0 +1,76 @@
+/*
+ * Implementation of growable auxiliary stacks.
+ */
+#include "dstack.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Macro generating the implementation of functions working with growable
+ * stacks. A more detailed description of the stacks is in dstack.h.
+ * Push doubles the capacity when the buffer is full, which makes it
+ * amortized O(1); the buffer is never shrunk.
+ */
+#define DSTACKDEF(T, TNAME)                                                    \
+  void dstack_##TNAME##_init(dstack_##TNAME##_t *stack) {                      \
+    stack->items = stack->inline_items;                                        \
+    stack->top = -1;                                                           \
+    stack->capacity = DSTACK_INLINE_SIZE;                                      \
+  }                                                                            \
+                                                                               \
+  bool dstack_##TNAME##_push(dstack_##TNAME##_t *stack, T item) {              \
+    if (stack->top == stack->capacity - 1) {                                   \
+      int capacity = stack->capacity * 2;                                      \
+      T *items;                                                                \
+      if (stack->items == stack->inline_items) {                               \
+        items = malloc(capacity * sizeof(T));                                  \
+        if (items != NULL) {                                                   \
+          memcpy(items, stack->inline_items, sizeof(stack->inline_items));     \
+        }                                                                      \
+      } else {                                                                 \
+        items = realloc(stack->items, capacity * sizeof(T));                   \
+      }                                                                        \
+      if (items == NULL) {                                                     \
+        printf("[W] Stack overflow\n");                                        \
+        return false;                                                          \
+      }                                                                        \
+      stack->items = items;                                                    \
+      stack->capacity = capacity;                                              \
+    }                                                                          \
+    stack->items[++stack->top] = item;                                         \
+    return true;                                                               \
+  }                                                                            \
+                                                                               \
+  T dstack_##TNAME##_top(dstack_##TNAME##_t *stack) {                          \
+    if (stack->top == -1) {                                                    \
+      return (T){0};                                                           \
+    }                                                                          \
+    return stack->items[stack->top];                                           \
+  }                                                                            \
+                                                                               \
+  T dstack_##TNAME##_pop(dstack_##TNAME##_t *stack) {                          \
+    if (stack->top == -1) {                                                    \
+      printf("[W] Stack underflow\n");                                         \
+      return (T){0};                                                           \
+    }                                                                          \
+    return stack->items[stack->top--];                                         \
+  }                                                                            \
+                                                                               \
+  bool dstack_##TNAME##_empty(dstack_##TNAME##_t *stack) {                     \
+    return stack->top == -1;                                                   \
+  }                                                                            \
+                                                                               \
+  void dstack_##TNAME##_clear(dstack_##TNAME##_t *stack) { stack->top = -1; }  \
+                                                                               \
+  void dstack_##TNAME##_free(dstack_##TNAME##_t *stack) {                      \
+    if (stack->items != stack->inline_items) {                                 \
+      free(stack->items);                                                      \
+    }                                                                          \
+    dstack_##TNAME##_init(stack);                                              \
+  }
+
+DSTACKDEF(bst_node_t *, bst)
+DSTACKDEF(bool, bool)
+
+/* End of btree/iter/dstack.c */
@@ -0,0 +1,52 @@
+/*
+ * Header file for growable auxiliary stacks.
+ * Same interface as the stacks in stack.h, but the items live in a buffer
+ * that doubles when full, so the depth of a traversal is not limited.
+ */
+#ifndef IAL_BTREE_ITER_DSTACK_H
+#define IAL_BTREE_ITER_DSTACK_H
+
+#include "../btree.h"
+
+// Number of items stored inside the stack itself, before the first malloc
+#define DSTACK_INLINE_SIZE 32
+
+/*
+ * Macro generating declarations for a growable stack of type T with the name
+ * infix TNAME. For TNAME="bst" working with type T="bst_node_t*":
+ *   Data type dstack_bst_t
+ *   Functions void dstack_bst_init(dstack_bst_t *stack)
+ *             bool dstack_bst_push(dstack_bst_t *stack, bst_node_t *item)
+ *             bst_node_t *dstack_bst_pop(dstack_bst_t *stack)
+ *             bst_node_t *dstack_bst_top(dstack_bst_t *stack)
+ *             bool dstack_bst_empty(dstack_bst_t *stack)
+ *             void dstack_bst_clear(dstack_bst_t *stack)
+ *             void dstack_bst_free(dstack_bst_t *stack)
+ * And equivalent for TNAME="bool", T="bool".
+ * The first DSTACK_INLINE_SIZE items are kept inside the structure, so a
+ * stack declared as a local variable costs no allocation for shallow trees.
+ * Clear empties the stack but keeps its buffer for reuse. A stack must not
+ * be copied, and must be released by dstack_TNAME_free.
+ */
+#define DSTACKDEC(T, TNAME)                                                    \
+  typedef struct {                                                             \
+    T *items;                                                                  \
+    int top;                                                                   \
+    int capacity;                                                              \
+    T inline_items[DSTACK_INLINE_SIZE];                                        \
+  } dstack_##TNAME##_t;                                                        \
+                                                                               \
+  void dstack_##TNAME##_init(dstack_##TNAME##_t *stack);                       \
+  bool dstack_##TNAME##_push(dstack_##TNAME##_t *stack, T item);               \
+  T dstack_##TNAME##_pop(dstack_##TNAME##_t *stack);                           \
+  T dstack_##TNAME##_top(dstack_##TNAME##_t *stack);                           \
+  bool dstack_##TNAME##_empty(dstack_##TNAME##_t *stack);                      \
+  void dstack_##TNAME##_clear(dstack_##TNAME##_t *stack);                      \
+  void dstack_##TNAME##_free(dstack_##TNAME##_t *stack);
+
+DSTACKDEC(bst_node_t *, bst)
+DSTACKDEC(bool, bool)
+
+#endif
+
+/* End of btree/iter/dstack.h */
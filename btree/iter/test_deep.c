@@ -0,0 +1,110 @@
+#include "../btree.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#undef TEST
+#undef ENDTEST
+
+#define TEST(NAME, DESCRIPTION)                                                \
+  void NAME() {                                                                \
+    printf("[%s] %s\n", #NAME, DESCRIPTION);                                   \
+    bst_node_t *test_tree;
+
+#define ENDTEST                                                                \
+  printf("\n");                                                                \
+  bst_dispose(&test_tree);                                                     \
+  }
+
+// Deeper than any fixed-size stack would be
+#define NODE_COUNT 1000000
+
+// Instead of printing, bst_print_node records the order of the visited values
+int visited;
+int out_of_order;
+int previous_value;
+int step;
+
+void bst_print_node(bst_node_t *node) {
+  if (visited > 0 && node->value != previous_value + step) {
+    out_of_order++;
+  }
+  previous_value = node->value;
+  visited++;
+}
+
+void start_traversal(int expected_step) {
+  visited = 0;
+  out_of_order = 0;
+  step = expected_step;
+}
+
+void print_traversal(const char *name) {
+  printf("%-10s visited %i nodes, %i out of order\n", name, visited,
+         out_of_order);
+}
+
+// Builds a degenerate tree of 'count' nodes, 'right' selects the direction
+// of the chain. Values grow in key order, keys are not used by traversals.
+bst_node_t *make_chain(int count, bool right) {
+  bst_node_t *tree = NULL;
+  for (int i = 0; i < count; i++) {
+    bst_node_t *node = malloc(sizeof(bst_node_t));
+    if (node == NULL) {
+      break;
+    }
+    node->key = 'A' + i % 26;
+    node->value = right ? count - 1 - i : i;
+    node->left = right ? NULL : tree;
+    node->right = right ? tree : NULL;
+    tree = node;
+  }
+  return tree;
+}
+
+void init_test() {
+  printf("Binary Search Tree - deep tree testing script\n");
+  printf("---------------------------------------------\n");
+  printf("\n");
+}
+
+TEST(test_left_chain, "Traverse a left-leaning chain of 1000000 nodes")
+test_tree = make_chain(NODE_COUNT, false);
+start_traversal(-1);
+bst_preorder(test_tree);
+print_traversal("preorder");
+start_traversal(1);
+bst_inorder(test_tree);
+print_traversal("inorder");
+start_traversal(1);
+bst_postorder(test_tree);
+print_traversal("postorder");
+ENDTEST
+
+TEST(test_right_chain, "Traverse a right-leaning chain of 1000000 nodes")
+test_tree = make_chain(NODE_COUNT, true);
+start_traversal(1);
+bst_preorder(test_tree);
+print_traversal("preorder");
+start_traversal(1);
+bst_inorder(test_tree);
+print_traversal("inorder");
+start_traversal(-1);
+bst_postorder(test_tree);
+print_traversal("postorder");
+ENDTEST
+
+TEST(test_dispose_deep, "Dispose a left-leaning chain of 1000000 nodes")
+test_tree = make_chain(NODE_COUNT, false);
+bst_dispose(&test_tree);
+printf("Tree is %s\n", test_tree == NULL ? "empty" : "not empty");
+ENDTEST
+
+int main(int argc, char *argv[]) {
+  init_test();
+
+  test_left_chain();
+  test_right_chain();
+  test_dispose_deep();
+}
+
+/* End of btree/iter/test_deep.c */
@@ -0,0 +1,113 @@
+#include "../btree.h"
+#include "bst_iter.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_TREE_SETUP                                                        \
+  bst_node_t *test_tree;                                                       \
+  bst_iter_t iter;                                                             \
+  bst_iter_init(&iter);
+
+#define TEST_TREE_TEARDOWN                                                     \
+  bst_iter_free(&iter);                                                        \
+  bst_dispose(&test_tree);
+
+#include "../test_util.h"
+
+#define PAGE_SIZE 4
+#define CHAIN_LENGTH 100000
+
+// Prints up to 'count' nodes, returns the number printed
+int print_page(bst_iter_t *iter, int count) {
+  int printed = 0;
+  bst_node_t *node;
+  while (printed < count && (node = bst_iter_next(iter)) != NULL) {
+    bst_print_node(node);
+    printed++;
+  }
+  printf("\n");
+  return printed;
+}
+
+void init_test() {
+  printf("Binary Search Tree - iterator testing script\n");
+  printf("--------------------------------------------\n");
+  printf("\n");
+}
+
+TEST(test_iter_empty, "Iterate an empty tree")
+bst_init(&test_tree);
+bst_iter_begin(&iter, test_tree);
+printf("Next: %s\n", bst_iter_next(&iter) == NULL ? "NULL" : "node");
+ENDTEST
+
+TEST(test_iter_pages, "Iterate in pages of 4 nodes")
+bst_init(&test_tree);
+bst_insert_many(&test_tree, base_keys, base_values, base_data_count);
+bst_iter_begin(&iter, test_tree);
+while (print_page(&iter, PAGE_SIZE) == PAGE_SIZE) {
+}
+ENDTEST
+
+TEST(test_iter_seek, "Seek to existing and missing keys")
+bst_init(&test_tree);
+bst_insert_many(&test_tree, base_keys, base_values, base_data_count);
+bst_iter_seek(&iter, test_tree, 'E');
+print_page(&iter, PAGE_SIZE);
+bst_insert(&test_tree, 'P', 17);
+bst_iter_seek(&iter, test_tree, 'M');
+print_page(&iter, PAGE_SIZE);
+bst_iter_seek(&iter, test_tree, '0');
+print_page(&iter, 2);
+bst_iter_seek(&iter, test_tree, 'Z');
+printf("Peek after Z: %s\n", bst_iter_peek(&iter) == NULL ? "NULL" : "node");
+ENDTEST
+
+TEST(test_iter_resume, "Resume after modifying the tree")
+bst_init(&test_tree);
+bst_insert_many(&test_tree, base_keys, base_values, base_data_count);
+bst_iter_begin(&iter, test_tree);
+print_page(&iter, PAGE_SIZE);
+char last_key = bst_iter_peek(&iter)->key - 1;
+bst_delete(&test_tree, 'H');
+bst_delete(&test_tree, 'E');
+bst_iter_seek(&iter, test_tree, last_key + 1);
+print_page(&iter, PAGE_SIZE);
+ENDTEST
+
+TEST(test_iter_deep, "Iterate a left-leaning chain of 100000 nodes")
+test_tree = NULL;
+for (int i = 0; i < CHAIN_LENGTH; i++) {
+  bst_node_t *node = malloc(sizeof(bst_node_t));
+  if (node == NULL) {
+    break;
+  }
+  node->key = 'A';
+  node->value = i;
+  node->left = test_tree;
+  node->right = NULL;
+  test_tree = node;
+}
+bst_iter_begin(&iter, test_tree);
+int count = 0, out_of_order = 0;
+bst_node_t *node;
+while ((node = bst_iter_next(&iter)) != NULL) {
+  if (node->value != count) {
+    out_of_order++;
+  }
+  count++;
+}
+printf("Visited %i nodes, %i out of order\n", count, out_of_order);
+ENDTEST
+
+int main(int argc, char *argv[]) {
+  init_test();
+
+  test_iter_empty();
+  test_iter_pages();
+  test_iter_seek();
+  test_iter_resume();
+  test_iter_deep();
+}
+
+/* End of btree/iter/test_iter.c */
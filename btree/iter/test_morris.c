@@ -0,0 +1,91 @@
+#include "../btree.h"
+#include "../test_util.h"
+#include "bst_morris.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define CHAIN_LENGTH 1000000
+
+// Stops at the node with the key given in the context
+int stop_at_key(bst_node_t *node, void *context) {
+  bst_print_node(node);
+  return node->key == *(char *)context ? node->key : 0;
+}
+
+// Counts the nodes and checks that the values grow by one
+int count_in_order(bst_node_t *node, void *context) {
+  int *count = context;
+  if (node->value != count[0]) {
+    count[1]++;
+  }
+  count[0]++;
+  return 0;
+}
+
+void init_test() {
+  printf("Binary Search Tree - Morris traversal testing script\n");
+  printf("----------------------------------------------------\n");
+  printf("\n");
+}
+
+TEST(test_morris_empty, "Traverse an empty tree")
+bst_init(&test_tree);
+bst_morris_inorder(test_tree);
+bst_morris_preorder(test_tree);
+printf("Done\n");
+ENDTEST
+
+TEST(test_morris_orders, "Compare with the stack-based traversals")
+bst_init(&test_tree);
+bst_insert_many(&test_tree, base_keys, base_values, base_data_count);
+printf("Inorder:         ");
+bst_inorder(test_tree);
+printf("\nMorris inorder:  ");
+bst_morris_inorder(test_tree);
+printf("\nPreorder:        ");
+bst_preorder(test_tree);
+printf("\nMorris preorder: ");
+bst_morris_preorder(test_tree);
+printf("\n");
+ENDTEST
+
+TEST(test_morris_early_exit, "Stop early, the tree is restored")
+bst_init(&test_tree);
+bst_insert_many(&test_tree, base_keys, base_values, base_data_count);
+char stop = 'E';
+int result = bst_morris_visit_inorder(test_tree, stop_at_key, &stop);
+printf("\nInorder stopped at %c\n", result);
+stop = 'C';
+result = bst_morris_visit_preorder(test_tree, stop_at_key, &stop);
+printf("\nPreorder stopped at %c\n", result);
+bst_print_tree(test_tree);
+ENDTEST
+
+TEST(test_morris_deep, "Traverse a left-leaning chain of 1000000 nodes")
+test_tree = NULL;
+for (int i = 0; i < CHAIN_LENGTH; i++) {
+  bst_node_t *node = malloc(sizeof(bst_node_t));
+  if (node == NULL) {
+    break;
+  }
+  node->key = 'A';
+  node->value = i;
+  node->left = test_tree;
+  node->right = NULL;
+  test_tree = node;
+}
+int count[2] = {0, 0};
+bst_morris_visit_inorder(test_tree, count_in_order, count);
+printf("Visited %i nodes, %i out of order\n", count[0], count[1]);
+ENDTEST
+
+int main(int argc, char *argv[]) {
+  init_test();
+
+  test_morris_empty();
+  test_morris_orders();
+  test_morris_early_exit();
+  test_morris_deep();
+}
+
+/* End of btree/iter/test_morris.c */
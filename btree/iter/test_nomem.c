@@ -0,0 +1,163 @@
+#include "../btree.h"
+#include "../bst_frozen.h"
+#include "bst_iter.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// Linked with -Wl,--wrap=malloc,--wrap=realloc,--wrap=free: allocations of
+// the tree code go through the wrappers below, which can be made to fail and
+// count the live blocks.
+void *__real_malloc(size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void __real_free(void *ptr);
+
+bool failing = false;
+int live_blocks = 0;
+
+void *__wrap_malloc(size_t size) {
+  void *ptr = failing ? NULL : __real_malloc(size);
+  live_blocks += ptr != NULL;
+  return ptr;
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+  if (failing) {
+    return NULL;
+  }
+  void *result = __real_realloc(ptr, size);
+  live_blocks += ptr == NULL && result != NULL;
+  return result;
+}
+
+void __wrap_free(void *ptr) {
+  live_blocks -= ptr != NULL;
+  __real_free(ptr);
+}
+
+// Deeper than the inline part of the stack
+#define CHAIN_LENGTH 100
+
+// Instead of printing, bst_print_node counts the visited nodes
+int visited;
+
+void bst_print_node(bst_node_t *node) { visited++; }
+
+int visit_count(bst_node_t *node, void *context) {
+  (*(int *)context)++;
+  return 0;
+}
+
+// Left chain of CHAIN_LENGTH nodes, each with a right leaf, so every
+// traversal needs a stack deeper than DSTACK_INLINE_SIZE
+void make_comb(bst_node_t **tree) {
+  bst_init(tree);
+  for (int i = 0; i < CHAIN_LENGTH; i++) {
+    bst_insert(tree, (char)(126 - 2 * i), i);
+  }
+  for (int i = 0; i < CHAIN_LENGTH; i++) {
+    bst_insert(tree, (char)(127 - 2 * i), CHAIN_LENGTH + i);
+  }
+}
+
+// Smallest key at the root, the rest a left chain in its right subtree, so
+// positioning needs only the inline stack and the first step needs more
+void make_hook(bst_node_t **tree) {
+  bst_init(tree);
+  bst_insert(tree, -128, 0);
+  for (int i = 0; i < CHAIN_LENGTH; i++) {
+    bst_insert(tree, (char)(127 - i), i + 1);
+  }
+}
+
+void print_traversal(const char *name, void (*traversal)(bst_node_t *),
+                     bst_node_t *tree) {
+  visited = 0;
+  traversal(tree);
+  printf("%-9s visited %i of %i nodes\n", name, visited, 2 * CHAIN_LENGTH);
+}
+
+void print_visit(const char *name,
+                 int (*visit)(bst_node_t *, bst_visitor_t, void *),
+                 bst_node_t *tree) {
+  int count = 0;
+  int result = visit(tree, visit_count, &count);
+  printf("%-9s visited %i nodes, %s\n", name, count,
+         result == BST_VISIT_NOMEM ? "out of memory" : "complete");
+}
+
+int main(int argc, char *argv[]) {
+  printf("Binary Search Tree - stack allocation failure testing script\n");
+  printf("------------------------------------------------------------\n");
+  printf("\n");
+
+  bst_node_t *tree;
+  make_comb(&tree);
+  printf("[test_nomem_ok] Traversals with working allocation\n");
+  print_visit("preorder", bst_visit_preorder, tree);
+  print_visit("inorder", bst_visit_inorder, tree);
+  print_visit("postorder", bst_visit_postorder, tree);
+  printf("\n");
+
+  failing = true;
+  printf("[test_nomem_print] Printing traversals stop when the stack fails\n");
+  print_traversal("preorder", bst_preorder, tree);
+  print_traversal("inorder", bst_inorder, tree);
+  print_traversal("postorder", bst_postorder, tree);
+  printf("\n");
+
+  printf("[test_nomem_visit] Visitors report the failure\n");
+  print_visit("preorder", bst_visit_preorder, tree);
+  print_visit("inorder", bst_visit_inorder, tree);
+  print_visit("postorder", bst_visit_postorder, tree);
+  int count = 0;
+  int result = bst_range(tree, -128, 127, visit_count, &count);
+  printf("%-9s visited %i nodes, %s\n", "range", count,
+         result == BST_VISIT_NOMEM ? "out of memory" : "complete");
+  printf("\n");
+
+  printf("[test_nomem_freeze] Freezing fails instead of truncating\n");
+  bst_frozen_t frozen;
+  bst_frozen_init(&frozen);
+  bool frozen_ok = bst_freeze(&frozen, tree, bst_eytzinger);
+  printf("freeze: %s, count: %i\n", frozen_ok ? "ok" : "failed", frozen.count);
+  bst_frozen_dispose(&frozen);
+  printf("\n");
+
+  printf("[test_nomem_iter] The iterator reports the failure and can retry\n");
+  bst_iter_t iter;
+  bst_iter_init(&iter);
+  printf("begin on the comb: %s\n",
+         bst_iter_begin(&iter, tree) ? "positioned" : "failed");
+  printf("seek on the comb: %s\n",
+         bst_iter_seek(&iter, tree, -128) ? "positioned" : "failed");
+  bst_node_t *hook;
+  failing = false;
+  make_hook(&hook);
+  bst_iter_begin(&iter, hook);
+  failing = true;
+  bst_node_t *node = bst_iter_next(&iter);
+  printf("next into the chain: %s, %s, still at value %i\n",
+         node == NULL ? "NULL" : "node",
+         bst_iter_failed(&iter) ? "failed" : "not failed",
+         bst_iter_peek(&iter)->value);
+  failing = false;
+  count = 0;
+  while (bst_iter_next(&iter) != NULL) {
+    count++;
+  }
+  printf("after the retry: %i of %i nodes, %s\n", count, CHAIN_LENGTH + 1,
+         bst_iter_failed(&iter) ? "failed" : "not failed");
+  bst_iter_free(&iter);
+  bst_dispose(&hook);
+  failing = true;
+  printf("\n");
+
+  printf("[test_nomem_dispose] Dispose releases every node\n");
+  bst_dispose(&tree);
+  failing = false;
+  printf("tree: %s, live blocks: %i\n", tree == NULL ? "NULL" : "not NULL",
+         live_blocks);
+  return 0;
+}
+
+/* End of btree/iter/test_nomem.c */
@@ -0,0 +1,530 @@
+/**
+ * @file btree/rb/btree.c
+ * @brief Binary Search Tree - Red-Black Variant
+ * @details This file implements the binary search tree interface from btree.h as a
+ *          red-black tree. Every node is red or black, the root is black, a red node has
+ *          no red descendant and every path from a node down to an empty subtree contains
+ *          the same number of black nodes. The height of the tree is therefore at most
+ *          2 * log2(n + 1).
+ *
+ *          Compared to the AVL variant, the balance condition is looser: an insertion
+ *          needs at most two rotations and a deletion at most three, everything else is
+ *          recolouring. This makes the variant cheaper for insert/delete-heavy workloads,
+ *          at the price of slightly deeper trees for lookups.
+ *
+ *          The key functions implemented in this file include:
+ *          - bst_init: Initializes the BST.
+ *          - bst_insert: Inserts or updates a node and restores the colouring.
+ *          - bst_search: Searches for a node in the BST.
+ *          - bst_delete: Deletes a node and restores the colouring.
+ *          - bst_dispose: Frees the entire BST.
+ *          - bst_preorder: Performs a preorder tree traversal.
+ *          - bst_inorder: Performs an inorder tree traversal.
+ *          - bst_postorder: Performs a postorder tree traversal.
+ *          - bst_replace_by_rightmost: Helper function for node deletion.
+ *
+ *          Insertion and deletion are iterative. The nodes have no parent pointers;
+ *          instead, the descent records the links (pointers to the `left`/`right` fields)
+ *          leading to the modified node, and the fix-up walks this path back up. The
+ *          path has at most RB_MAX_DEPTH entries, which covers any tree that fits in memory.
+ *
+ * @code
+ * bst_node_t *tree;
+ * bst_init(&tree);
+ * for (char key = 'A'; key <= 'Z'; key++) {
+ *     bst_insert(&tree, key, key - 'A'); // sorted input, the tree stays balanced
+ * }
+ * bst_dispose(&tree);
+ * @endcode
+ *
+ * @see btree.h for type definitions and function prototypes.
+ * @see btree/avl/btree.c for the AVL variant.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project02-2021 for the project repository.
+ */
+
+#include "../btree.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// Maximal length of a root-to-leaf path (2 * log2(n + 1) for n < 2^63, plus slack)
+#define RB_MAX_DEPTH 130
+
+/**
+ * @brief Returns whether a node is red; empty subtrees are black.
+ *
+ * @param node The node, may be NULL.
+ *
+ * @retval true The node exists and is red.
+ * @retval false The node is black or NULL.
+ */
+static bool rb_is_red(bst_node_t *node) {
+    return node != NULL && node->red;
+}
+
+/**
+ * @brief Rotates the subtree to the left.
+ *
+ * @details The right descendant becomes the root of the subtree and the old root becomes
+ *          its left descendant. Colours are left unchanged.
+ *
+ * @param link A pointer to the link (root pointer or `left`/`right` field) holding the subtree.
+ *
+ * @pre The root has a right descendant.
+ *
+ * @return This function does not return a value.
+ */
+static void rb_rotate_left(bst_node_t **link) {
+    bst_node_t *rootPtr = *link;
+    bst_node_t *pivot = rootPtr->right;
+
+    rootPtr->right = pivot->left;
+    pivot->left = rootPtr;
+    *link = pivot;
+}
+
+/**
+ * @brief Rotates the subtree to the right.
+ *
+ * @details Mirror image of `rb_rotate_left`.
+ *
+ * @param link A pointer to the link holding the subtree.
+ *
+ * @pre The root has a left descendant.
+ *
+ * @return This function does not return a value.
+ */
+static void rb_rotate_right(bst_node_t **link) {
+    bst_node_t *rootPtr = *link;
+    bst_node_t *pivot = rootPtr->left;
+
+    rootPtr->left = pivot->right;
+    pivot->right = rootPtr;
+    *link = pivot;
+}
+
+/**
+ * @brief Unlinks a node with at most one descendant and restores the colouring.
+ *
+ * @details The descendant (or NULL) takes the place of the node. Removing a red node, or
+ *          a black one whose descendant is red and can be recoloured, keeps all black heights.
+ *          Otherwise the position is "doubly black" and the deficit is pushed up the path by
+ *          recolouring the sibling, until it can be resolved by at most three rotations.
+ *
+ * @param path Links from the root of the (sub)tree down to the removed node; 'path[0]' is
+ *             the root link. The array must have room for two more entries.
+ * @param depth The index of the link holding the removed node.
+ *
+ * @pre '*path[depth]' has at most one descendant and the path is consistent.
+ *
+ * @post The node is freed. If 'path[0]' is the root of the whole tree, the tree is a valid
+ *       red-black tree.
+ *
+ * @return This function does not return a value.
+ */
+static void rb_remove(bst_node_t **path[], int depth) {
+    bst_node_t *removed = *path[depth];
+    bst_node_t *child = removed->left != NULL ? removed->left : removed->right;
+    bool removedRed = removed->red;
+
+    *path[depth] = child;
+    free(removed);
+
+    // Removing a red node does not change any black height
+    if (removedRed) {
+        return;
+    }
+
+    // Move the missing black node up until a red node or the root absorbs it
+    while (depth > 0 && !rb_is_red(*path[depth])) {
+        bst_node_t *parent = *path[depth - 1];
+        bool isLeft = path[depth] == &parent->left;
+        bst_node_t *sibling = isLeft ? parent->right : parent->left;
+
+        // Red sibling, rotate it above the parent so that the new sibling is black
+        if (sibling->red) {
+            sibling->red = false;
+            parent->red = true;
+            if (isLeft) {
+                rb_rotate_left(path[depth - 1]);
+                path[depth] = &sibling->left;
+                path[depth + 1] = &parent->left;
+            }
+            else {
+                rb_rotate_right(path[depth - 1]);
+                path[depth] = &sibling->right;
+                path[depth + 1] = &parent->right;
+            }
+            depth++;
+            sibling = isLeft ? parent->right : parent->left;
+        }
+
+        // Black sibling with black descendants, recolour and continue with the parent
+        if (!rb_is_red(sibling->left) && !rb_is_red(sibling->right)) {
+            sibling->red = true;
+            depth--;
+            continue;
+        }
+
+        // Black sibling with a red descendant, at most two rotations finish the job
+        if (isLeft) {
+            // The red descendant is the inner one, move it to the outside first
+            if (!rb_is_red(sibling->right)) {
+                sibling->left->red = false;
+                sibling->red = true;
+                rb_rotate_right(&parent->right);
+                sibling = parent->right;
+            }
+            sibling->red = parent->red;
+            parent->red = false;
+            sibling->right->red = false;
+            rb_rotate_left(path[depth - 1]);
+        }
+        else {
+            if (!rb_is_red(sibling->left)) {
+                sibling->right->red = false;
+                sibling->red = true;
+                rb_rotate_left(&parent->left);
+                sibling = parent->left;
+            }
+            sibling->red = parent->red;
+            parent->red = false;
+            sibling->left->red = false;
+            rb_rotate_right(path[depth - 1]);
+        }
+        return;
+    }
+
+    // A red node (or the root) absorbs the missing black
+    if (*path[depth] != NULL) {
+        (*path[depth])->red = false;
+    }
+}
+
+/**
+ * @brief Initializes a binary search tree to an empty state.
+ *
+ * @param tree A double pointer to the binary search tree that will be initialized.
+ *
+ * @warning If 'tree' already points to an initialized binary search tree, this operation
+ *          will lead to memory leaks unless the nodes are freed beforehand.
+ *
+ * @return This function does not return a value.
+ */
+void bst_init(bst_node_t **tree) {
+    // NULL check
+    if (tree != NULL) {
+        *tree = NULL;
+    }
+}
+
+/**
+ * @brief Searches for a node with the specified key in the tree.
+ *
+ * @details Colours play no role in searching, it is a plain loop down from the root.
+ *
+ * @param tree The root node of the binary search tree to search within.
+ * @param key The key of the node to search for.
+ * @param value Pointer to an integer where the value of the found node will be written.
+ *
+ * @post If a node with the specified key is found, 'value' is updated with the node's value.
+ *       Otherwise, 'value' remains unchanged.
+ *
+ * @retval true A node with the specified key was found and 'value' was updated.
+ * @retval false No node with the specified key was found and 'value' was not updated.
+ */
+bool bst_search(bst_node_t *tree, char key, int *value) {
+    while (tree != NULL) {
+        // If the node with the searched key is found
+        if (tree->key == key) {
+            *value = tree->value;
+            return true;
+        }
+        tree = key < tree->key ? tree->left : tree->right;
+    }
+    return false;
+}
+
+/**
+ * @brief Adds or updates a node and restores the colouring.
+ *
+ * @details Descends from the root, recording the links on the way. A new node is attached
+ *          as a red leaf. While its parent is red as well, either the red uncle allows
+ *          recolouring the parent, the uncle and the grandparent (and the check continues
+ *          two levels higher), or one or two rotations at the grandparent end the fix-up.
+ *          Updating the value of an existing key does not change the tree.
+ *
+ * @param tree A double pointer to the root of the binary search tree.
+ * @param key The unique identifier for the node.
+ * @param value The associated value for the node.
+ *
+ * @pre 'tree' references the root pointer of a valid red-black tree (which may be NULL).
+ *
+ * @post The tree contains the key with the given value and is a valid red-black tree.
+ *
+ * @warning If memory allocation for a new node fails, the function silently fails without
+ *          inserting.
+ *
+ * @return This function does not return a value.
+ */
+void bst_insert(bst_node_t **tree, char key, int value) {
+
+    // NULL check
+    if (tree == NULL) {
+        return;
+    }
+
+    // Links from the root to the new node
+    bst_node_t **path[RB_MAX_DEPTH];
+    int depth = 0;
+
+    // Find the place of the key
+    bst_node_t **link = tree;
+    while (*link != NULL) {
+        bst_node_t *node = *link;
+        // The keys are equal, only update the value
+        if (node->key == key) {
+            node->value = value;
+            return;
+        }
+        path[depth++] = link;
+        link = key < node->key ? &node->left : &node->right;
+    }
+
+    // Attach a new red leaf
+    bst_node_t *node = malloc(sizeof(bst_node_t));
+    if (node == NULL) {
+        return;
+    }
+    node->key = key;
+    node->value = value;
+    node->left = NULL;
+    node->right = NULL;
+    node->red = true;
+    *link = node;
+    path[depth] = link;
+
+    // Resolve red-red conflicts, 'node' is at 'depth', its parent at 'depth - 1'
+    while (depth >= 2 && rb_is_red(*path[depth - 1])) {
+        node = *path[depth];
+        bst_node_t *parent = *path[depth - 1];
+        bst_node_t *grandparent = *path[depth - 2];
+        bool parentIsLeft = parent == grandparent->left;
+        bst_node_t *uncle = parentIsLeft ? grandparent->right : grandparent->left;
+
+        // Red uncle, push the red up to the grandparent
+        if (rb_is_red(uncle)) {
+            parent->red = false;
+            uncle->red = false;
+            grandparent->red = true;
+            depth -= 2;
+            continue;
+        }
+
+        // Black uncle, rotate the middle key of the three nodes up to the grandparent's place
+        if (parentIsLeft) {
+            if (node == parent->right) {
+                rb_rotate_left(path[depth - 1]);
+            }
+            rb_rotate_right(path[depth - 2]);
+        }
+        else {
+            if (node == parent->left) {
+                rb_rotate_right(path[depth - 1]);
+            }
+            rb_rotate_left(path[depth - 2]);
+        }
+        (*path[depth - 2])->red = false;
+        grandparent->red = true;
+        break;
+    }
+
+    // The root is always black
+    (*tree)->red = false;
+}
+
+/**
+ * @brief Replaces the target node with the rightmost node of a subtree.
+ *
+ * @details Moves the key and value of the rightmost node of 'tree' to 'target' and removes
+ *          the rightmost node, restoring the colouring inside the subtree.
+ *
+ * @param target Pointer to the node whose key and value will be replaced.
+ * @param tree Double pointer to the root of the non-empty subtree containing the rightmost node.
+ *
+ * @pre 'tree' points to a non-empty subtree.
+ *
+ * @post The rightmost node is freed and the subtree is a valid binary search tree.
+ *
+ * @warning The fix-up cannot look above 'tree', so the black height of the subtree may drop
+ *          by one. `bst_delete` does not use this function for that reason; it is only fully
+ *          safe when 'tree' is the root of the whole tree.
+ *
+ * @return This function does not return a value.
+ */
+void bst_replace_by_rightmost(bst_node_t *target, bst_node_t **tree) {
+
+    // NULL check
+    if (tree == NULL || *tree == NULL) {
+        return;
+    }
+
+    // Links from 'tree' to the rightmost node, room for two more for the fix-up
+    bst_node_t **path[RB_MAX_DEPTH + 2];
+    int depth = 0;
+
+    // Walk to the rightmost node
+    path[0] = tree;
+    while ((*path[depth])->right != NULL) {
+        path[depth + 1] = &(*path[depth])->right;
+        depth++;
+    }
+
+    target->key = (*path[depth])->key;
+    target->value = (*path[depth])->value;
+    rb_remove(path, depth);
+}
+
+/**
+ * @brief Removes a node with the specified key and restores the colouring.
+ *
+ * @details Descends from the root, recording the links. A node with two descendants takes
+ *          over the key and value of the rightmost node of its left subtree, whose path is
+ *          appended, so that the node actually removed always has at most one descendant.
+ *          The colouring is then restored by `rb_remove`.
+ *
+ * @param tree A double pointer to the root of the binary search tree.
+ * @param key The key of the node to be removed.
+ *
+ * @pre 'tree' references the root pointer of a valid red-black tree.
+ *
+ * @post The node with the specified key is removed, if it existed, and the tree is a valid
+ *       red-black tree.
+ *
+ * @return This function does not return a value.
+ */
+void bst_delete(bst_node_t **tree, char key) {
+
+    // NULL check
+    if (tree == NULL) {
+        return;
+    }
+
+    // Links from the root to the removed node, room for two more for the fix-up
+    bst_node_t **path[RB_MAX_DEPTH + 2];
+    int depth = 0;
+
+    // Find the node
+    path[0] = tree;
+    while (*path[depth] != NULL && (*path[depth])->key != key) {
+        bst_node_t *node = *path[depth];
+        path[depth + 1] = key < node->key ? &node->left : &node->right;
+        depth++;
+    }
+
+    // If the key is not in the tree
+    if (*path[depth] == NULL) {
+        return;
+    }
+
+    // If the node has both descendants, remove the rightmost node of the left subtree instead
+    bst_node_t *target = *path[depth];
+    if (target->left != NULL && target->right != NULL) {
+        path[depth + 1] = &target->left;
+        depth++;
+        while ((*path[depth])->right != NULL) {
+            path[depth + 1] = &(*path[depth])->right;
+            depth++;
+        }
+        target->key = (*path[depth])->key;
+        target->value = (*path[depth])->value;
+    }
+
+    rb_remove(path, depth);
+}
+
+/**
+ * @brief Eliminates all nodes from the tree, deallocating memory.
+ *
+ * @details Iterative and without a stack: a node with a left descendant is rotated right,
+ *          until the current node has no left descendant and can be freed.
+ *
+ * @param tree A double pointer to the root of the binary search tree to be disposed of.
+ *
+ * @post 'tree' is set to NULL and all memory has been freed.
+ *
+ * @return This function does not return a value.
+ */
+void bst_dispose(bst_node_t **tree) {
+
+    // NULL check
+    if (tree == NULL) {
+        return;
+    }
+
+    bst_node_t *node = *tree;
+    while (node != NULL) {
+        // Rotate the left descendant up
+        if (node->left != NULL) {
+            bst_node_t *leftNode = node->left;
+            node->left = leftNode->right;
+            leftNode->right = node;
+            node = leftNode;
+        }
+        else {// No left descendant, free the node and continue to the right
+            bst_node_t *rightNode = node->right;
+            free(node);
+            node = rightNode;
+        }
+    }
+    *tree = NULL;
+}
+
+/**
+ * @brief Traverses the tree in preorder (root, left, right) and prints the nodes.
+ *
+ * @details Recursive; the depth is bounded by the height of the tree, which is logarithmic.
+ *
+ * @param tree The root node of the binary search tree to traverse.
+ *
+ * @return This function does not return a value.
+ */
+void bst_preorder(bst_node_t *tree) {
+    if (tree != NULL) {
+        bst_print_node(tree);
+        bst_preorder(tree->left);
+        bst_preorder(tree->right);
+    }
+}
+
+/**
+ * @brief Traverses the tree in inorder (left, root, right) and prints the nodes.
+ *
+ * @param tree The root node of the binary search tree to traverse.
+ *
+ * @return This function does not return a value.
+ */
+void bst_inorder(bst_node_t *tree) {
+    if (tree != NULL) {
+        bst_inorder(tree->left);
+        bst_print_node(tree);
+        bst_inorder(tree->right);
+    }
+}
+
+/**
+ * @brief Traverses the tree in postorder (left, right, root) and prints the nodes.
+ *
+ * @param tree The root node of the binary search tree to traverse.
+ *
+ * @return This function does not return a value.
+ */
+void bst_postorder(bst_node_t *tree) {
+    if (tree != NULL) {
+        bst_postorder(tree->left);
+        bst_postorder(tree->right);
+        bst_print_node(tree);
+    }
+}
+
+/* End of btree/rb/btree.c */
@@ -18,6 +18,12 @@
  *          - bst_inorder: Performs an inorder tree traversal.
  *          - bst_postorder: Performs a postorder tree traversal.
  *          - bst_replace_by_rightmost: Helper function for node deletion.
+ *          - bst_visit_preorder, bst_visit_inorder, bst_visit_postorder: Traversals
+ *            calling a user-supplied visitor with early exit.
+ *          - bst_range: Visits the nodes with keys in a range, pruning the other subtrees.
+ *          - bst_count_range: Counts the keys in a range using the subtree sizes.
+ *          - bst_rank: Returns the number of keys smaller than a key.
+ *          - bst_select: Returns the node with the k-th smallest key.
  *          - bst_print_node: Helper function to print a node's key and value.
  * 
  *          Each of these functions is documented with appropriate preconditions,
@@ -49,9 +55,32 @@
  */
 
 #include "../btree.h"
+#include "../bst_pool.h"
 #include <stdio.h>
 #include <stdlib.h>
 
+/**
+ * @brief Returns the number of nodes in a subtree.
+ *
+ * @param tree The root of the subtree, may be NULL.
+ *
+ * @return The size stored in the root node, 0 for an empty subtree.
+ */
+static int bst_size(bst_node_t *tree) {
+    return tree != NULL ? tree->size : 0;
+}
+
+/**
+ * @brief Recomputes the subtree size of a node from its descendants.
+ *
+ * @param node The node to update, must not be NULL.
+ *
+ * @return This function does not return a value.
+ */
+static void bst_update_size(bst_node_t *node) {
+    node->size = bst_size(node->left) + bst_size(node->right) + 1;
+}
+
 /**
  * @brief Initializes a binary search tree to an empty state.
  * 
@@ -196,7 +225,7 @@ void bst_insert(bst_node_t **tree, char key, int value) {
     // If the subtree is empty
     if (rootPtr == NULL) {
         // Allocate and initialize it
-        rootPtr = malloc(sizeof(bst_node_t));
+        rootPtr = bst_node_alloc();
         if (rootPtr == NULL) {
             return;
         }
@@ -204,6 +233,7 @@ void bst_insert(bst_node_t **tree, char key, int value) {
         rootPtr->left = NULL;
         rootPtr->right = NULL;
         rootPtr->value = value;
+        rootPtr->size = 1;
 
         // If the entire tree is empty
         if (*tree == NULL) {
@@ -223,6 +253,8 @@ void bst_insert(bst_node_t **tree, char key, int value) {
         else {
             rootPtr->value = value;
         }
+        // The subtree may have grown
+        bst_update_size(rootPtr);
     }
 }
 
@@ -262,6 +294,7 @@ void bst_replace_by_rightmost(bst_node_t *target, bst_node_t **tree) {
     // If there's a path to the right, move right
     if (rootPrt->right != NULL) {
         bst_replace_by_rightmost(target, &rootPrt->right);
+        bst_update_size(rootPrt);
     }
     else {// No path to the right, update target and remove the node
         target->key = rootPrt->key;
@@ -318,10 +351,12 @@ void bst_delete(bst_node_t **tree, char key) {
     // If the searched key is on the left
     else if (key < rootPrt->key) {
         bst_delete(&(rootPrt->left), key);
+        bst_update_size(rootPrt);
     }
     // If the searched key is on the right
     else if (rootPrt->key < key) {
         bst_delete(&(rootPrt->right), key);
+        bst_update_size(rootPrt);
     }
     // If the key is found
     else {
@@ -340,10 +375,11 @@ void bst_delete(bst_node_t **tree, char key) {
         // If the subtree has both descendants
         else {
             bst_replace_by_rightmost(rootPrt, &((*tree)->left));
+            bst_update_size(rootPrt);
             return;
         }
         // Free the node
-        free(rootPrt);
+        bst_node_release(rootPrt);
     }
 }
 
@@ -387,7 +423,7 @@ void bst_dispose(bst_node_t **tree) {
         bst_dispose(&((*tree)->left));
         bst_dispose(&((*tree)->right));
         // Free the root
-        free(*tree);
+        bst_node_release(*tree);
         *tree = NULL;
     }
 }
@@ -498,4 +534,285 @@ void bst_postorder(bst_node_t *tree) {
     }
 }
 
+/**
+ * @brief Traverses a binary search tree in preorder and calls a visitor for each node.
+ *
+ * @details Same order as `bst_preorder` (root, then left subtree, then right subtree), but
+ *          instead of printing, every node is passed to 'visitor' together with 'context'.
+ *          This allows aggregating, serializing or filtering the nodes without stdio.
+ *          A non-zero return value of the visitor stops the traversal immediately.
+ *
+ * @param tree The root node of the binary search tree to traverse.
+ * @param visitor Function called for each visited node.
+ * @param context Caller data passed unchanged to every 'visitor' call.
+ *
+ * @pre 'visitor' must not be NULL. The visitor must not modify the structure of the tree.
+ *
+ * @post The visitor was called for the nodes in preorder, up to the one that stopped the traversal.
+ *
+ * @code
+ * int sum_values(bst_node_t *node, void *context) {
+ *     *(long *) context += node->value;
+ *     return 0;
+ * }
+ * long sum = 0;
+ * bst_visit_preorder(tree, sum_values, &sum);
+ * @endcode
+ *
+ * @retval 0 All nodes were visited.
+ * @retval non-zero The value returned by the visitor that stopped the traversal.
+ */
+int bst_visit_preorder(bst_node_t *tree, bst_visitor_t visitor, void *context) {
+
+    // If the subtree is empty
+    if (tree == NULL) {
+        return 0;
+    }
+
+    int result = visitor(tree, context);
+    if (result == 0) {
+        result = bst_visit_preorder(tree->left, visitor, context);
+    }
+    if (result == 0) {
+        result = bst_visit_preorder(tree->right, visitor, context);
+    }
+    return result;
+}
+
+/**
+ * @brief Traverses a binary search tree in inorder and calls a visitor for each node.
+ *
+ * @details Same order as `bst_inorder` (ascending keys), with the nodes passed to 'visitor'
+ *          instead of being printed. A non-zero return value of the visitor stops the traversal.
+ *
+ * @param tree The root node of the binary search tree to traverse.
+ * @param visitor Function called for each visited node.
+ * @param context Caller data passed unchanged to every 'visitor' call.
+ *
+ * @pre 'visitor' must not be NULL. The visitor must not modify the structure of the tree.
+ *
+ * @post The visitor was called for the nodes in inorder, up to the one that stopped the traversal.
+ *
+ * @retval 0 All nodes were visited.
+ * @retval non-zero The value returned by the visitor that stopped the traversal.
+ */
+int bst_visit_inorder(bst_node_t *tree, bst_visitor_t visitor, void *context) {
+
+    // If the subtree is empty
+    if (tree == NULL) {
+        return 0;
+    }
+
+    int result = bst_visit_inorder(tree->left, visitor, context);
+    if (result == 0) {
+        result = visitor(tree, context);
+    }
+    if (result == 0) {
+        result = bst_visit_inorder(tree->right, visitor, context);
+    }
+    return result;
+}
+
+/**
+ * @brief Traverses a binary search tree in postorder and calls a visitor for each node.
+ *
+ * @details Same order as `bst_postorder` (left subtree, right subtree, root), with the nodes
+ *          passed to 'visitor' instead of being printed. A non-zero return value of the visitor
+ *          stops the traversal.
+ *
+ * @param tree The root node of the binary search tree to traverse.
+ * @param visitor Function called for each visited node.
+ * @param context Caller data passed unchanged to every 'visitor' call.
+ *
+ * @pre 'visitor' must not be NULL. The visitor must not modify the structure of the tree.
+ *
+ * @post The visitor was called for the nodes in postorder, up to the one that stopped the traversal.
+ *
+ * @retval 0 All nodes were visited.
+ * @retval non-zero The value returned by the visitor that stopped the traversal.
+ */
+int bst_visit_postorder(bst_node_t *tree, bst_visitor_t visitor, void *context) {
+
+    // If the subtree is empty
+    if (tree == NULL) {
+        return 0;
+    }
+
+    int result = bst_visit_postorder(tree->left, visitor, context);
+    if (result == 0) {
+        result = bst_visit_postorder(tree->right, visitor, context);
+    }
+    if (result == 0) {
+        result = visitor(tree, context);
+    }
+    return result;
+}
+
+/**
+ * @brief Calls a visitor for every node with a key in [low, high], in ascending key order.
+ *
+ * @details Like `bst_visit_inorder`, but subtrees that cannot contain keys of the range are
+ *          skipped: the left subtree only when the node's key is greater than 'low', the right
+ *          subtree only when it is less than 'high'. Only the nodes on the two boundary paths
+ *          and the reported nodes are visited, O(height + k) for k reported nodes.
+ *
+ * @param tree The root node of the binary search tree.
+ * @param low The smallest key of the range.
+ * @param high The largest key of the range.
+ * @param visitor Function called for each node in the range.
+ * @param context Caller data passed unchanged to every 'visitor' call.
+ *
+ * @pre 'visitor' must not be NULL. The visitor must not modify the structure of the tree.
+ *
+ * @code
+ * int print_visitor(bst_node_t *node, void *context) {
+ *     bst_print_node(node);
+ *     return 0;
+ * }
+ * bst_range(tree, 'C', 'F', print_visitor, NULL); // prints C, D, E and F if present
+ * @endcode
+ *
+ * @retval 0 All nodes of the range were visited (or the range is empty).
+ * @retval non-zero The value returned by the visitor that stopped the traversal.
+ */
+int bst_range(bst_node_t *tree, char low, char high, bst_visitor_t visitor, void *context) {
+
+    // If the subtree is empty
+    if (tree == NULL) {
+        return 0;
+    }
+
+    int result = 0;
+    // Smaller keys of the range can only be on the left
+    if (low < tree->key) {
+        result = bst_range(tree->left, low, high, visitor, context);
+    }
+    // If the node itself is in the range
+    if (result == 0 && low <= tree->key && tree->key <= high) {
+        result = visitor(tree, context);
+    }
+    // Larger keys of the range can only be on the right
+    if (result == 0 && tree->key < high) {
+        result = bst_range(tree->right, low, high, visitor, context);
+    }
+    return result;
+}
+
+/**
+ * @brief Counts the nodes whose key is less than 'key' (or equal to it, if 'inclusive').
+ *
+ * @details Follows a single path from the root. Whenever the path turns right, the node and
+ *          its whole left subtree are counted at once using the stored subtree size.
+ *
+ * @param tree The root node of the binary search tree.
+ * @param key The bound.
+ * @param inclusive Whether a node with the key equal to 'key' is counted.
+ *
+ * @return The number of nodes below the bound.
+ */
+static int bst_count_below(bst_node_t *tree, char key, bool inclusive) {
+
+    // If the subtree is empty
+    if (tree == NULL) {
+        return 0;
+    }
+    // If the node is below the bound, count it with its left subtree and go right
+    if (tree->key < key || (inclusive && tree->key == key)) {
+        return bst_size(tree->left) + 1 + bst_count_below(tree->right, key, inclusive);
+    }
+    // Otherwise everything below the bound is on the left
+    return bst_count_below(tree->left, key, inclusive);
+}
+
+/**
+ * @brief Counts the nodes with a key in [low, high].
+ *
+ * @details Uses the subtree sizes maintained by `bst_insert` and `bst_delete`: the result is
+ *          the number of keys not greater than 'high' minus the number of keys less than
+ *          'low'. Each of the two counts walks one root-to-leaf path, so the cost is
+ *          O(height) regardless of how many keys are in the range.
+ *
+ * @param tree The root node of the binary search tree.
+ * @param low The smallest key of the range.
+ * @param high The largest key of the range.
+ *
+ * @pre The subtree sizes are valid, i.e. the tree was only modified by `bst_insert`,
+ *      `bst_delete` and `bst_replace_by_rightmost`.
+ *
+ * @return The number of keys in the range, 0 if 'low' is greater than 'high'.
+ */
+int bst_count_range(bst_node_t *tree, char low, char high) {
+
+    // If the range is empty
+    if (high < low) {
+        return 0;
+    }
+
+    return bst_count_below(tree, high, true) - bst_count_below(tree, low, false);
+}
+
+/**
+ * @brief Returns the rank of a key, the number of keys in the tree smaller than it.
+ *
+ * @details The key itself does not have to be in the tree. Uses the subtree sizes, so the
+ *          cost is one root-to-leaf path, O(height), instead of an inorder traversal.
+ *
+ * @param tree The root node of the binary search tree.
+ * @param key The key to rank.
+ *
+ * @pre The subtree sizes are valid (see `bst_count_range`).
+ *
+ * @code
+ * // Keys A, C, E
+ * bst_rank(tree, 'A'); // 0
+ * bst_rank(tree, 'D'); // 2
+ * @endcode
+ *
+ * @return The number of keys less than 'key'.
+ */
+int bst_rank(bst_node_t *tree, char key) {
+    return bst_count_below(tree, key, false);
+}
+
+/**
+ * @brief Returns the node with the k-th smallest key, counting from 0.
+ *
+ * @details Compares 'k' with the size of the left subtree at each node: a smaller 'k' is
+ *          in the left subtree, an equal one is the node itself, and a larger one continues in
+ *          the right subtree with the left subtree and the node skipped. Inverse of `bst_rank`
+ *          for keys in the tree: `bst_select(tree, bst_rank(tree, key))` is the node of 'key'.
+ *          Runs in O(height).
+ *
+ * @param tree The root node of the binary search tree.
+ * @param k The number of keys smaller than the wanted one.
+ *
+ * @pre The subtree sizes are valid (see `bst_count_range`).
+ *
+ * @code
+ * bst_node_t *median = bst_select(tree, tree->size / 2);
+ * @endcode
+ *
+ * @retval NULL 'k' is negative or not less than the number of nodes.
+ * @retval non-NULL The node with exactly 'k' smaller keys.
+ */
+bst_node_t *bst_select(bst_node_t *tree, int k) {
+
+    // If the subtree is empty or k is out of range
+    if (tree == NULL || k < 0 || k >= tree->size) {
+        return NULL;
+    }
+
+    int leftSize = bst_size(tree->left);
+    // If the key is on the left
+    if (k < leftSize) {
+        return bst_select(tree->left, k);
+    }
+    // If the node is the k-th one
+    else if (k == leftSize) {
+        return tree;
+    }
+    // The key is on the right, skip the left subtree and the node
+    return bst_select(tree->right, k - leftSize - 1);
+}
+
 /* End of btree/rec/btree.c */
@@ -2,11 +2,6 @@
 #include "test_util.h"
 #include <stdio.h>
 
-const int base_data_count = 15;
-const char base_keys[] = {'H', 'D', 'L', 'B', 'F', 'J', 'N', 'A',
-                          'C', 'E', 'G', 'I', 'K', 'M', 'O'};
-const int base_values[] = {8, 4, 12, 2, 6, 10, 14, 1, 3, 5, 7, 9, 11, 13, 16};
-
 const int additional_data_count = 6;
 const char additional_keys[] = {'S', 'R', 'Q', 'P', 'X', 'Y', 'Z'};
 const int additional_values[] = {10, 10, 10, 10, 10, 10};
@@ -0,0 +1,100 @@
+#include "btree.h"
+#include <limits.h>
+#include <stdio.h>
+
+#define TEST_TREE_TEARDOWN bst_dispose_sorted(&test_tree);
+
+#include "test_util.h"
+
+#define KEY_COUNT (CHAR_MAX - CHAR_MIN + 1)
+
+const int sorted_data_count = 15;
+const char sorted_keys[] = {'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
+                            'I', 'J', 'K', 'L', 'M', 'N', 'O'};
+const int sorted_values[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 16};
+
+// Returns the height of the tree, -1 if it is not a valid, balanced BST
+// with correct subtree sizes
+int check_tree(bst_node_t *tree, int low, int high) {
+  if (tree == NULL) {
+    return 0;
+  }
+  if (tree->key < low || tree->key > high) {
+    return -1;
+  }
+  int left = check_tree(tree->left, low, tree->key - 1);
+  int right = check_tree(tree->right, tree->key + 1, high);
+  int left_size = tree->left != NULL ? tree->left->size : 0;
+  int right_size = tree->right != NULL ? tree->right->size : 0;
+  if (left < 0 || right < 0 || left - right > 1 || right - left > 1 ||
+      tree->size != left_size + right_size + 1) {
+    return -1;
+  }
+  return (left > right ? left : right) + 1;
+}
+
+void init_test() {
+  printf("Binary Search Tree - bulk build testing script\n");
+  printf("----------------------------------------------\n");
+  printf("\n");
+}
+
+TEST(test_build_empty, "Build from no keys")
+test_tree = bst_build_sorted(sorted_keys, sorted_values, 0);
+bst_print_tree(test_tree);
+ENDTEST
+
+TEST(test_build_unsorted, "Reject unsorted and duplicate keys")
+const char unsorted[] = {'A', 'C', 'B'};
+const char duplicate[] = {'A', 'B', 'B'};
+test_tree = bst_build_sorted(unsorted, sorted_values, 3);
+printf("Unsorted: %s\n", test_tree == NULL ? "rejected" : "built");
+test_tree = bst_build_sorted(duplicate, sorted_values, 3);
+printf("Duplicate: %s\n", test_tree == NULL ? "rejected" : "built");
+ENDTEST
+
+TEST(test_build_base, "Build the base tree from sorted keys")
+test_tree = bst_build_sorted(sorted_keys, sorted_values, sorted_data_count);
+bst_print_tree(test_tree);
+int value = 0;
+bool found = bst_search(test_tree, 'K', &value);
+printf("Search K: %s, value %i\n", found ? "found" : "not found", value);
+printf("Rank of K: %i, count [C..F]: %i\n", bst_rank(test_tree, 'K'),
+       bst_count_range(test_tree, 'C', 'F'));
+printf("Inorder: ");
+bst_inorder(test_tree);
+printf("\n");
+ENDTEST
+
+TEST(test_build_all_sizes, "Build every size up to 256 keys")
+char keys[KEY_COUNT];
+int values[KEY_COUNT];
+for (int i = 0; i < KEY_COUNT; i++) {
+  keys[i] = (char)(CHAR_MIN + i);
+  values[i] = i;
+}
+int failures = 0;
+for (int count = 1; count <= KEY_COUNT; count++) {
+  test_tree = bst_build_sorted(keys, values, count);
+  int minimal_height = 0;
+  while ((1 << minimal_height) <= count) {
+    minimal_height++;
+  }
+  if (check_tree(test_tree, CHAR_MIN, CHAR_MAX) != minimal_height) {
+    failures++;
+  }
+  bst_dispose_sorted(&test_tree);
+}
+printf("%i sizes, %i failures\n", KEY_COUNT, failures);
+ENDTEST
+
+int main(int argc, char *argv[]) {
+  init_test();
+
+  test_build_empty();
+  test_build_unsorted();
+  test_build_base();
+  test_build_all_sizes();
+}
+
+/* End of btree/test_build.c */
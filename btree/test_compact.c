@@ -0,0 +1,191 @@
+#include "bst_compact.h"
+#include "btree.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_TREE_SETUP                                                        \
+  bst_compact_t test_tree;                                                     \
+  bst_compact_init(&test_tree);
+
+#define TEST_TREE_TEARDOWN                                                     \
+  bst_compact_dispose(&test_tree);
+
+#include "test_util.h"
+
+#define RANDOM_OPERATIONS 20000
+
+// Prints every slot of the node array
+void print_slots(bst_compact_t *tree) {
+  printf("root: %u, count: %u\n", tree->root, tree->count);
+  for (uint32_t i = 1; i <= tree->count; i++) {
+    bst_compact_node_t *node = &tree->nodes[i];
+    printf("%2u: [%c,%i] left %u, right %u\n", i, node->key, node->value,
+           node->left, node->right);
+  }
+}
+
+void print_search(bst_compact_t *tree, char key) {
+  int value;
+  if (bst_compact_search(tree, key, &value)) {
+    printf("search(%c): %i\n", key, value);
+  } else {
+    printf("search(%c): not found\n", key);
+  }
+}
+
+// Counts the nodes that differ between the compact and the pointer tree
+int count_differences(bst_compact_t *tree, uint32_t index, bst_node_t *node) {
+  if (index == BST_COMPACT_NIL || node == NULL) {
+    return index != BST_COMPACT_NIL || node != NULL;
+  }
+  bst_compact_node_t *compact = &tree->nodes[index];
+  return (compact->key != node->key || compact->value != node->value) +
+         count_differences(tree, compact->left, node->left) +
+         count_differences(tree, compact->right, node->right);
+}
+
+void init_test() {
+  printf("Binary Search Tree - compact layout testing script\n");
+  printf("--------------------------------------------------\n");
+  printf("\n");
+}
+
+TEST(test_compact_empty, "Search and delete in an empty tree")
+print_search(&test_tree, 'A');
+bst_compact_delete(&test_tree, 'A');
+print_slots(&test_tree);
+ENDTEST
+
+TEST(test_compact_insert, "Insert the base data")
+for (int i = 0; i < base_data_count; i++) {
+  bst_compact_insert(&test_tree, base_keys[i], base_values[i]);
+}
+bst_compact_insert(&test_tree, 'O', 15);
+print_slots(&test_tree);
+print_search(&test_tree, 'O');
+print_search(&test_tree, 'X');
+printf("node size: %i bytes\n", (int)sizeof(bst_compact_node_t));
+ENDTEST
+
+TEST(test_compact_delete, "Delete a leaf, a node with one and with two children")
+for (int i = 0; i < base_data_count; i++) {
+  bst_compact_insert(&test_tree, base_keys[i], base_values[i]);
+}
+bst_compact_delete(&test_tree, 'A');
+bst_compact_delete(&test_tree, 'B');
+bst_compact_delete(&test_tree, 'H');
+bst_compact_delete(&test_tree, 'X');
+print_slots(&test_tree);
+print_search(&test_tree, 'H');
+print_search(&test_tree, 'G');
+ENDTEST
+
+TEST(test_compact_from_tree, "Copy a pointer tree in breadth-first order")
+bst_node_t *tree;
+bst_init(&tree);
+bst_insert_many(&tree, base_keys, base_values, base_data_count);
+bst_compact_from_tree(&test_tree, tree);
+print_slots(&test_tree);
+printf("differences: %i\n", count_differences(&test_tree, test_tree.root, tree));
+bst_dispose(&tree);
+ENDTEST
+
+TEST(test_compact_save_load, "Save the tree and load it back")
+for (int i = 0; i < base_data_count; i++) {
+  bst_compact_insert(&test_tree, base_keys[i], base_values[i]);
+}
+bst_compact_delete(&test_tree, 'D');
+FILE *file = tmpfile();
+if (file == NULL) {
+  printf("tmpfile failed\n");
+} else {
+  bool saved = bst_compact_save(&test_tree, file);
+  printf("save: %s, %li bytes\n", saved ? "ok" : "failed", ftell(file));
+  rewind(file);
+  bst_compact_t loaded;
+  bst_compact_init(&loaded);
+  printf("load: %s\n", bst_compact_load(&loaded, file) ? "ok" : "failed");
+  print_slots(&loaded);
+  bst_compact_dispose(&loaded);
+
+  // A damaged header is rejected
+  rewind(file);
+  fputc('X', file);
+  rewind(file);
+  printf("load damaged: %s\n",
+         bst_compact_load(&loaded, file) ? "ok" : "failed");
+  fclose(file);
+}
+ENDTEST
+
+// Writes a header and 'count' nodes, then tries to load them
+void load_crafted(const char *name, uint32_t root, uint32_t count,
+                  bst_compact_node_t nodes[], int written) {
+  FILE *file = tmpfile();
+  if (file == NULL) {
+    printf("tmpfile failed\n");
+    return;
+  }
+  bst_compact_node_t header = {root, count, BST_COMPACT_MAGIC, 0};
+  fwrite(&header, sizeof(header), 1, file);
+  fwrite(nodes, sizeof(bst_compact_node_t), written, file);
+  rewind(file);
+  bst_compact_t loaded;
+  bst_compact_init(&loaded);
+  printf("load %s: %s\n", name,
+         bst_compact_load(&loaded, file) ? "ok" : "failed");
+  bst_compact_dispose(&loaded);
+  fclose(file);
+}
+
+TEST(test_compact_load_crafted, "Reject crafted files")
+bst_compact_node_t valid[] = {{2, 0, 1, 'B'}, {0, 0, 2, 'A'}};
+load_crafted("valid", 1, 2, valid, 2);
+bst_compact_node_t cycle[] = {{0, 2, 1, 'A'}, {1, 0, 2, 'B'}};
+load_crafted("cycle", 1, 2, cycle, 2);
+bst_compact_node_t shared[] = {{2, 2, 1, 'B'}, {0, 0, 2, 'A'}};
+load_crafted("shared child", 1, 2, shared, 2);
+bst_compact_node_t unreachable[] = {{0, 0, 1, 'A'}, {0, 0, 2, 'B'}};
+load_crafted("unreachable node", 1, 2, unreachable, 2);
+bst_compact_node_t outside[] = {{3, 0, 1, 'B'}, {0, 0, 2, 'A'}};
+load_crafted("index outside", 1, 2, outside, 2);
+load_crafted("huge count", 1, 0x80000000u, valid, 2);
+load_crafted("truncated", 1, 1000, valid, 2);
+load_crafted("truncated huge count", 1, BST_COMPACT_MAX_COUNT, valid, 2);
+ENDTEST
+
+TEST(test_compact_random, "Compare with a pointer tree after random updates")
+bst_node_t *tree;
+bst_init(&tree);
+srand(17);
+int differences = 0;
+for (int i = 0; i < RANDOM_OPERATIONS; i++) {
+  char key = (char)(CHAR_MIN + rand() % (CHAR_MAX - CHAR_MIN + 1));
+  if (rand() % 3 != 0) {
+    bst_insert(&tree, key, i);
+    bst_compact_insert(&test_tree, key, i);
+  } else {
+    bst_delete(&tree, key);
+    bst_compact_delete(&test_tree, key);
+  }
+  differences += count_differences(&test_tree, test_tree.root, tree);
+}
+printf("%i operations, %i differences, %u nodes\n", RANDOM_OPERATIONS,
+       differences, test_tree.count);
+bst_dispose(&tree);
+ENDTEST
+
+int main(int argc, char *argv[]) {
+  init_test();
+
+  test_compact_empty();
+  test_compact_insert();
+  test_compact_delete();
+  test_compact_from_tree();
+  test_compact_save_load();
+  test_compact_load_crafted();
+  test_compact_random();
+}
+
+/* End of btree/test_compact.c */
@@ -0,0 +1,145 @@
+#include "bst_frozen.h"
+#include "btree.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_TREE_SETUP                                                        \
+  bst_node_t *test_tree;                                                       \
+  bst_frozen_t frozen;                                                         \
+  bst_frozen_init(&frozen);
+
+#define TEST_TREE_TEARDOWN                                                     \
+  bst_frozen_dispose(&frozen);                                                 \
+  bst_dispose(&test_tree);
+
+#include "test_util.h"
+
+#define RANDOM_TREES 200
+
+const bst_frozen_layout_t layouts[] = {bst_eytzinger, bst_veb};
+const char *layout_names[] = {"eytzinger", "veb"};
+
+void print_frozen(bst_frozen_t *frozen) {
+  printf("count: %i, size: %i, height: %i\n", frozen->count, frozen->size,
+         frozen->height);
+  printf("keys:");
+  for (int i = 0; i < frozen->size; i++) {
+    printf(" %c", frozen->keys[i] != 0 ? frozen->keys[i] : '-');
+  }
+  printf("\n");
+}
+
+void print_search(bst_frozen_t *frozen, char key) {
+  int value;
+  if (bst_frozen_search(frozen, key, &value)) {
+    printf("search(%c): %i\n", key, value);
+  } else {
+    printf("search(%c): not found\n", key);
+  }
+}
+
+// Counts the keys whose search differs from bst_search
+int count_mismatches(bst_frozen_t *frozen, bst_node_t *tree) {
+  int mismatches = 0;
+  for (int k = CHAR_MIN; k <= CHAR_MAX; k++) {
+    int expected = -1, actual = -1;
+    bool in_tree = bst_search(tree, (char)k, &expected);
+    bool in_frozen = bst_frozen_search(frozen, (char)k, &actual);
+    if (in_tree != in_frozen || expected != actual) {
+      mismatches++;
+    }
+  }
+  return mismatches;
+}
+
+void init_test() {
+  printf("Binary Search Tree - frozen snapshot testing script\n");
+  printf("---------------------------------------------------\n");
+  printf("\n");
+}
+
+TEST(test_frozen_empty, "Freeze an empty tree")
+bst_init(&test_tree);
+for (int l = 0; l < 2; l++) {
+  printf("%s: %s\n", layout_names[l],
+         bst_freeze(&frozen, test_tree, layouts[l]) ? "ok" : "failed");
+  print_search(&frozen, 'A');
+}
+ENDTEST
+
+TEST(test_frozen_base, "Freeze the base tree in both layouts")
+bst_init(&test_tree);
+bst_insert_many(&test_tree, base_keys, base_values, base_data_count);
+for (int l = 0; l < 2; l++) {
+  printf("%s:\n", layout_names[l]);
+  bst_freeze(&frozen, test_tree, layouts[l]);
+  print_frozen(&frozen);
+  print_search(&frozen, 'A');
+  print_search(&frozen, 'H');
+  print_search(&frozen, 'O');
+  print_search(&frozen, 'P');
+  print_search(&frozen, '0');
+  printf("mismatches: %i\n", count_mismatches(&frozen, test_tree));
+}
+ENDTEST
+
+TEST(test_frozen_padded, "Freeze trees that are not perfect")
+bst_init(&test_tree);
+for (int i = 0; i < 10; i++) {
+  bst_insert(&test_tree, base_keys[i], base_values[i]);
+}
+for (int l = 0; l < 2; l++) {
+  printf("%s:\n", layout_names[l]);
+  bst_freeze(&frozen, test_tree, layouts[l]);
+  print_frozen(&frozen);
+  print_search(&frozen, 'J');
+  print_search(&frozen, 'K');
+  printf("mismatches: %i\n", count_mismatches(&frozen, test_tree));
+}
+ENDTEST
+
+TEST(test_frozen_random, "Compare with bst_search on random trees")
+bst_init(&test_tree);
+srand(5);
+int mismatches = 0;
+for (int t = 0; t < RANDOM_TREES; t++) {
+  // Trees from 1 to 256 keys, from all keys to a narrow range
+  int count = 1 + rand() % (CHAR_MAX - CHAR_MIN + 1);
+  int span = 1 + rand() % (CHAR_MAX - CHAR_MIN + 1);
+  int low = CHAR_MIN + rand() % (CHAR_MAX - CHAR_MIN + 2 - span);
+  for (int i = 0; i < count; i++) {
+    bst_insert(&test_tree, (char)(low + rand() % span), i);
+  }
+  for (int l = 0; l < 2; l++) {
+    bst_freeze(&frozen, test_tree, layouts[l]);
+    mismatches += count_mismatches(&frozen, test_tree);
+  }
+  bst_dispose(&test_tree);
+}
+printf("%i trees, %i mismatches\n", RANDOM_TREES, mismatches);
+ENDTEST
+
+TEST(test_frozen_degenerate, "Freeze a tree built from sorted keys")
+bst_init(&test_tree);
+for (int k = CHAR_MIN; k <= CHAR_MAX; k++) {
+  bst_insert(&test_tree, (char)k, k);
+}
+for (int l = 0; l < 2; l++) {
+  bst_freeze(&frozen, test_tree, layouts[l]);
+  printf("%s: height %i, mismatches %i\n", layout_names[l], frozen.height,
+         count_mismatches(&frozen, test_tree));
+}
+ENDTEST
+
+int main(int argc, char *argv[]) {
+  init_test();
+
+  test_frozen_empty();
+  test_frozen_base();
+  test_frozen_padded();
+  test_frozen_random();
+  test_frozen_degenerate();
+}
+
+/* End of btree/test_frozen.c */
@@ -0,0 +1,121 @@
+#include "bst_pool.h"
+#include "btree.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Every test runs with its own pool selected
+#define TEST_TREE_SETUP                                                        \
+  bst_node_t *test_tree;                                                       \
+  bst_pool_t pool;                                                             \
+  bst_pool_init(&pool, 16);                                                    \
+  bst_pool_use(&pool);
+
+#define TEST_TREE_TEARDOWN                                                     \
+  bst_dispose(&test_tree);                                                     \
+  bst_pool_use(NULL);                                                          \
+  bst_pool_free(&pool);
+
+#include "test_util.h"
+
+#define RANDOM_OPERATIONS 20000
+
+// Checks that the inorder keys are strictly increasing and match 'present'
+int count_mismatches(bst_node_t *tree, bool present[], int *key) {
+  if (tree == NULL) {
+    return 0;
+  }
+  int mismatches = count_mismatches(tree->left, present, key);
+  while (*key < tree->key) {
+    mismatches += present[*key - CHAR_MIN];
+    (*key)++;
+  }
+  if (*key != tree->key || !present[*key - CHAR_MIN]) {
+    mismatches++;
+  }
+  (*key)++;
+  return mismatches + count_mismatches(tree->right, present, key);
+}
+
+void init_test() {
+  printf("Binary Search Tree - node pool testing script\n");
+  printf("---------------------------------------------\n");
+  printf("\n");
+}
+
+TEST(test_pool_insert, "Insert the base data into a pooled tree")
+bst_init(&test_tree);
+bst_insert_many(&test_tree, base_keys, base_values, base_data_count);
+bst_print_tree(test_tree);
+printf("slabs: %i\n", pool.slab_count);
+ENDTEST
+
+TEST(test_pool_reuse, "A deleted node is reused by the next insert")
+bst_init(&test_tree);
+bst_insert_many(&test_tree, base_keys, base_values, base_data_count);
+bst_node_t *node = test_tree->left->left->left; // A, a leaf
+bst_delete(&test_tree, 'A');
+bst_insert(&test_tree, 'P', 17);
+printf("reused: %s\n", node->key == 'P' ? "yes" : "no");
+bst_print_tree(test_tree);
+printf("slabs: %i\n", pool.slab_count);
+ENDTEST
+
+TEST(test_pool_reset, "Reset drops the tree and keeps the slabs")
+bst_init(&test_tree);
+bst_insert_many(&test_tree, base_keys, base_values, base_data_count);
+bst_insert(&test_tree, 'P', 17);
+bst_insert(&test_tree, 'Q', 18);
+printf("slabs before reset: %i\n", pool.slab_count);
+bst_node_t *first = test_tree;
+bst_pool_reset(&pool);
+bst_init(&test_tree);
+bst_insert(&test_tree, 'X', 24);
+printf("first slot reused: %s\n", test_tree == first ? "yes" : "no");
+bst_insert_many(&test_tree, base_keys, base_values, base_data_count);
+bst_print_tree(test_tree);
+printf("slabs after refill: %i\n", pool.slab_count);
+ENDTEST
+
+TEST(test_pool_churn, "Random inserts and deletes stay within the pool")
+bst_init(&test_tree);
+bool present[CHAR_MAX - CHAR_MIN + 1] = {false};
+srand(23);
+int live = 0, peak = 0;
+for (int i = 0; i < RANDOM_OPERATIONS; i++) {
+  char key = (char)(CHAR_MIN + rand() % (CHAR_MAX - CHAR_MIN + 1));
+  bool *slot = &present[key - CHAR_MIN];
+  if (rand() % 2 == 0) {
+    bst_insert(&test_tree, key, i);
+    live += !*slot;
+    *slot = true;
+  } else {
+    bst_delete(&test_tree, key);
+    live -= *slot;
+    *slot = false;
+  }
+  peak = live > peak ? live : peak;
+}
+int key = CHAR_MIN;
+int mismatches = count_mismatches(test_tree, present, &key);
+while (key <= CHAR_MAX) {
+  mismatches += present[key - CHAR_MIN];
+  key++;
+}
+printf("%i operations, %i mismatches\n", RANDOM_OPERATIONS, mismatches);
+printf("slabs within peak: %s\n",
+       pool.slab_count == (peak + pool.slab_nodes - 1) / pool.slab_nodes
+           ? "yes"
+           : "no");
+ENDTEST
+
+int main(int argc, char *argv[]) {
+  init_test();
+
+  test_pool_insert();
+  test_pool_reuse();
+  test_pool_reset();
+  test_pool_churn();
+}
+
+/* End of btree/test_pool.c */
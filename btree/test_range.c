@@ -0,0 +1,106 @@
+#include "btree.h"
+#include "test_util.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define RANDOM_OPERATIONS 20000
+
+int print_visitor(bst_node_t *node, void *context) {
+  bst_print_node(node);
+  return 0;
+}
+
+// Prints up to the number of nodes given in the context, then stops
+int print_limited(bst_node_t *node, void *context) {
+  int *remaining = context;
+  bst_print_node(node);
+  return --*remaining == 0 ? 1 : 0;
+}
+
+void print_range(bst_node_t *tree, char low, char high) {
+  printf("[%c..%c] count %i: ", low, high, bst_count_range(tree, low, high));
+  bst_range(tree, low, high, print_visitor, NULL);
+  printf("\n");
+}
+
+void init_test() {
+  printf("Binary Search Tree - range testing script\n");
+  printf("-----------------------------------------\n");
+  printf("\n");
+}
+
+TEST(test_range_empty, "Ranges in an empty tree")
+bst_init(&test_tree);
+print_range(test_tree, 'A', 'Z');
+ENDTEST
+
+TEST(test_range_base, "Ranges in the base tree")
+bst_init(&test_tree);
+bst_insert_many(&test_tree, base_keys, base_values, base_data_count);
+print_range(test_tree, 'C', 'F');
+print_range(test_tree, 'A', 'O');
+print_range(test_tree, '0', 'B');
+print_range(test_tree, 'N', 'Z');
+print_range(test_tree, 'H', 'H');
+print_range(test_tree, 'P', 'Z');
+print_range(test_tree, 'F', 'C');
+ENDTEST
+
+TEST(test_range_early_exit, "Stop after three nodes")
+bst_init(&test_tree);
+bst_insert_many(&test_tree, base_keys, base_values, base_data_count);
+int remaining = 3;
+int result = bst_range(test_tree, 'E', 'M', print_limited, &remaining);
+printf("\nResult %i\n", result);
+ENDTEST
+
+TEST(test_range_after_delete, "Counts after deleting nodes with two descendants")
+bst_init(&test_tree);
+bst_insert_many(&test_tree, base_keys, base_values, base_data_count);
+bst_delete(&test_tree, 'H');
+bst_delete(&test_tree, 'D');
+bst_delete(&test_tree, 'Z');
+bst_insert(&test_tree, 'B', 20);
+print_range(test_tree, 'A', 'O');
+print_range(test_tree, 'C', 'I');
+ENDTEST
+
+TEST(test_range_random, "Compare counts with a brute-force count")
+bst_init(&test_tree);
+bool present[CHAR_MAX - CHAR_MIN + 1] = {false};
+srand(7);
+int mismatches = 0;
+for (int i = 0; i < RANDOM_OPERATIONS; i++) {
+  char key = (char)(CHAR_MIN + rand() % (CHAR_MAX - CHAR_MIN + 1));
+  if (rand() % 3 != 0) {
+    bst_insert(&test_tree, key, i);
+    present[key - CHAR_MIN] = true;
+  } else {
+    bst_delete(&test_tree, key);
+    present[key - CHAR_MIN] = false;
+  }
+  char low = (char)(CHAR_MIN + rand() % (CHAR_MAX - CHAR_MIN + 1));
+  char high = (char)(CHAR_MIN + rand() % (CHAR_MAX - CHAR_MIN + 1));
+  int expected = 0;
+  for (int k = low; k <= high; k++) {
+    expected += present[k - CHAR_MIN];
+  }
+  if (bst_count_range(test_tree, low, high) != expected) {
+    mismatches++;
+  }
+}
+printf("%i operations, %i mismatches\n", RANDOM_OPERATIONS, mismatches);
+ENDTEST
+
+int main(int argc, char *argv[]) {
+  init_test();
+
+  test_range_empty();
+  test_range_base();
+  test_range_early_exit();
+  test_range_after_delete();
+  test_range_random();
+}
+
+/* End of btree/test_range.c */
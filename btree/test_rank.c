@@ -0,0 +1,104 @@
+#include "btree.h"
+#include "test_util.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define RANDOM_OPERATIONS 20000
+
+void print_select(bst_node_t *tree, int k) {
+  bst_node_t *node = bst_select(tree, k);
+  printf("select(%i): ", k);
+  if (node != NULL) {
+    bst_print_node(node);
+  } else {
+    printf("NULL");
+  }
+  printf("\n");
+}
+
+void init_test() {
+  printf("Binary Search Tree - rank and select testing script\n");
+  printf("---------------------------------------------------\n");
+  printf("\n");
+}
+
+TEST(test_rank_empty, "Rank and select in an empty tree")
+bst_init(&test_tree);
+printf("rank(A): %i\n", bst_rank(test_tree, 'A'));
+print_select(test_tree, 0);
+ENDTEST
+
+TEST(test_rank_base, "Rank and select in the base tree")
+bst_init(&test_tree);
+bst_insert_many(&test_tree, base_keys, base_values, base_data_count);
+printf("rank(A): %i, rank(H): %i, rank(O): %i, rank(Z): %i, rank(0): %i\n",
+       bst_rank(test_tree, 'A'), bst_rank(test_tree, 'H'),
+       bst_rank(test_tree, 'O'), bst_rank(test_tree, 'Z'),
+       bst_rank(test_tree, '0'));
+print_select(test_tree, 0);
+print_select(test_tree, 7);
+print_select(test_tree, 14);
+print_select(test_tree, 15);
+print_select(test_tree, -1);
+ENDTEST
+
+TEST(test_rank_after_delete, "Rank and select after deletes")
+bst_init(&test_tree);
+bst_insert_many(&test_tree, base_keys, base_values, base_data_count);
+bst_delete(&test_tree, 'H');
+bst_delete(&test_tree, 'B');
+bst_delete(&test_tree, 'O');
+printf("rank(H): %i, rank(I): %i\n", bst_rank(test_tree, 'H'),
+       bst_rank(test_tree, 'I'));
+print_select(test_tree, 1);
+print_select(test_tree, 5);
+print_select(test_tree, 11);
+print_select(test_tree, 12);
+ENDTEST
+
+TEST(test_rank_random, "Compare with a sorted array after random updates")
+bst_init(&test_tree);
+bool present[CHAR_MAX - CHAR_MIN + 1] = {false};
+srand(11);
+int mismatches = 0;
+for (int i = 0; i < RANDOM_OPERATIONS; i++) {
+  char key = (char)(CHAR_MIN + rand() % (CHAR_MAX - CHAR_MIN + 1));
+  if (rand() % 3 != 0) {
+    bst_insert(&test_tree, key, i);
+    present[key - CHAR_MIN] = true;
+  } else {
+    bst_delete(&test_tree, key);
+    present[key - CHAR_MIN] = false;
+  }
+  // Every key must have the rank of its position among the present keys
+  int rank = 0;
+  for (int k = CHAR_MIN; k <= CHAR_MAX; k++) {
+    if (bst_rank(test_tree, (char)k) != rank) {
+      mismatches++;
+    }
+    if (present[k - CHAR_MIN]) {
+      bst_node_t *node = bst_select(test_tree, rank);
+      if (node == NULL || node->key != (char)k) {
+        mismatches++;
+      }
+      rank++;
+    }
+  }
+  if (bst_select(test_tree, rank) != NULL) {
+    mismatches++;
+  }
+}
+printf("%i operations, %i mismatches\n", RANDOM_OPERATIONS, mismatches);
+ENDTEST
+
+int main(int argc, char *argv[]) {
+  init_test();
+
+  test_rank_empty();
+  test_rank_base();
+  test_rank_after_delete();
+  test_rank_random();
+}
+
+/* End of btree/test_rank.c */
@@ -3,6 +3,11 @@
 #include <stdlib.h>
 #include <string.h>
 
+const int base_data_count = 15;
+const char base_keys[] = {'H', 'D', 'L', 'B', 'F', 'J', 'N', 'A',
+                          'C', 'E', 'G', 'I', 'K', 'M', 'O'};
+const int base_values[] = {8, 4, 12, 2, 6, 10, 14, 1, 3, 5, 7, 9, 11, 13, 16};
+
 const char *subtree_prefix = "  |";
 const char *space_prefix = "   ";
 
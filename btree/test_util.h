@@ -4,18 +4,33 @@
 #include "btree.h"
 #include <stdio.h>
 
+// The tests of a feature define TEST_TREE_SETUP and TEST_TREE_TEARDOWN before
+// including this header when their trees need another setup or teardown.
+#ifndef TEST_TREE_SETUP
+#define TEST_TREE_SETUP bst_node_t *test_tree;
+#endif
+
+#ifndef TEST_TREE_TEARDOWN
+#define TEST_TREE_TEARDOWN bst_dispose(&test_tree);
+#endif
+
 #define TEST(NAME, DESCRIPTION)                                                \
   void NAME() {                                                                \
     printf("[%s] %s\n", #NAME, DESCRIPTION);                                   \
-    bst_node_t *test_tree;
+    TEST_TREE_SETUP
 
 #define ENDTEST                                                                \
   printf("\n");                                                                \
-  bst_dispose(&test_tree);                                                     \
+  TEST_TREE_TEARDOWN                                                           \
   }
 
 typedef enum direction { left, right, none } direction_t;
 
+// Keys and values that build a perfectly balanced tree of 15 nodes
+extern const int base_data_count;
+extern const char base_keys[];
+extern const int base_values[];
+
 void bst_print_subtree(bst_node_t *tree, char *prefix, direction_t from);
 void bst_print_tree(bst_node_t *tree);
 void bst_insert_many(bst_node_t **tree, const char keys[], const int values[],
@@ -0,0 +1,75 @@
+#include "btree.h"
+#include "test_util.h"
+#include <stdio.h>
+
+// Appends the key of the node to the string in the context
+int collect_keys(bst_node_t *node, void *context) {
+  char *keys = context;
+  while (*keys != '\0') {
+    keys++;
+  }
+  keys[0] = node->key;
+  keys[1] = '\0';
+  return 0;
+}
+
+// Sums the values, stops with the key of the first node with value > 10
+int sum_until_large(bst_node_t *node, void *context) {
+  int *sum = context;
+  if (node->value > 10) {
+    return node->key;
+  }
+  *sum += node->value;
+  return 0;
+}
+
+void init_test() {
+  printf("Binary Search Tree - visitor testing script\n");
+  printf("-------------------------------------------\n");
+  printf("\n");
+}
+
+TEST(test_visit_empty, "Visit an empty tree")
+bst_init(&test_tree);
+char keys[32] = "";
+int result = bst_visit_inorder(test_tree, collect_keys, keys);
+printf("Result %i, keys \"%s\"\n", result, keys);
+ENDTEST
+
+TEST(test_visit_orders, "Collect the keys in all three orders")
+bst_init(&test_tree);
+bst_insert_many(&test_tree, base_keys, base_values, base_data_count);
+char keys[32] = "";
+bst_visit_preorder(test_tree, collect_keys, keys);
+printf("Preorder:  %s\n", keys);
+keys[0] = '\0';
+bst_visit_inorder(test_tree, collect_keys, keys);
+printf("Inorder:   %s\n", keys);
+keys[0] = '\0';
+bst_visit_postorder(test_tree, collect_keys, keys);
+printf("Postorder: %s\n", keys);
+ENDTEST
+
+TEST(test_visit_early_exit, "Stop at the first value greater than 10")
+bst_init(&test_tree);
+bst_insert_many(&test_tree, base_keys, base_values, base_data_count);
+int sum = 0;
+int result = bst_visit_preorder(test_tree, sum_until_large, &sum);
+printf("Preorder:  stopped at %c, sum %i\n", result, sum);
+sum = 0;
+result = bst_visit_inorder(test_tree, sum_until_large, &sum);
+printf("Inorder:   stopped at %c, sum %i\n", result, sum);
+sum = 0;
+result = bst_visit_postorder(test_tree, sum_until_large, &sum);
+printf("Postorder: stopped at %c, sum %i\n", result, sum);
+ENDTEST
+
+int main(int argc, char *argv[]) {
+  init_test();
+
+  test_visit_empty();
+  test_visit_orders();
+  test_visit_early_exit();
+}
+
+/* End of btree/test_visit.c */
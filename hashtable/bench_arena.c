@@ -0,0 +1,73 @@
+#include "hashtable_dyn.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define KEY_COUNT (1 << 20)
+#define KEY_LENGTH 16
+#define ROUNDS 3
+
+typedef char key_t_[KEY_LENGTH];
+
+static double now_seconds() {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Keeps the compiler from dropping the lookups
+volatile float sink;
+
+void bench_table(const char *name, bool use_arena, key_t_ *keys) {
+  double insert = 0, lookup = 0, teardown = 0;
+
+  for (int round = 0; round < ROUNDS; round++) {
+    ht_dyn_table_t table;
+    if (use_arena) {
+      ht_dyn_init_arena(&table, 0);
+    } else {
+      ht_dyn_init(&table, 0);
+    }
+
+    double start = now_seconds();
+    for (int i = 0; i < KEY_COUNT; i++) {
+      ht_dyn_insert(&table, keys[i], i);
+    }
+    insert += now_seconds() - start;
+
+    start = now_seconds();
+    for (int i = 0; i < KEY_COUNT; i++) {
+      sink = *ht_dyn_get(&table, keys[i]);
+    }
+    lookup += now_seconds() - start;
+
+    start = now_seconds();
+    ht_dyn_free(&table);
+    teardown += now_seconds() - start;
+  }
+
+  printf("%-8s %10.1f %10.1f %12.2f\n", name,
+         insert * 1e9 / ROUNDS / KEY_COUNT, lookup * 1e9 / ROUNDS / KEY_COUNT,
+         teardown * 1e3 / ROUNDS);
+}
+
+int main(int argc, char *argv[]) {
+  key_t_ *keys = malloc(KEY_COUNT * sizeof(key_t_));
+  if (keys == NULL) {
+    return 1;
+  }
+  for (int i = 0; i < KEY_COUNT; i++) {
+    sprintf(keys[i], "key%i", i);
+  }
+
+  printf("Item allocation - %i keys, average of %i rounds\n", KEY_COUNT,
+         ROUNDS);
+  printf("-----------------------------------------------\n");
+  printf("mode      insert ns  lookup ns  teardown ms\n");
+  bench_table("malloc", false, keys);
+  bench_table("arena", true, keys);
+
+  free(keys);
+}
+
+/* End of bench_arena.c */
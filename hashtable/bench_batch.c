@@ -0,0 +1,95 @@
+#include "hashtable_dyn.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Large enough for the items and buckets to exceed the last-level cache
+#define KEY_COUNT (1 << 23)
+#define LOOKUPS (1 << 22)
+#define KEY_LENGTH 16
+
+typedef char key_t_[KEY_LENGTH];
+
+static double now_seconds() {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Keeps the compiler from dropping the lookups
+volatile float sink;
+
+int main(int argc, char *argv[]) {
+  const int batch_sizes[] = {1, 2, 4, 8, 16, 32, 64, 128, 256};
+  int key_count = argc > 1 ? atoi(argv[1]) : KEY_COUNT;
+  key_t_ *keys = malloc(key_count * sizeof(key_t_));
+  char **order = malloc(LOOKUPS * sizeof(char *));
+  float *insert_values = malloc(LOOKUPS * sizeof(float));
+  float *values[256];
+
+  if (key_count <= 0 || keys == NULL || order == NULL ||
+      insert_values == NULL) {
+    return 1;
+  }
+  for (int i = 0; i < key_count; i++) {
+    sprintf(keys[i], "key%i", i);
+  }
+  // Random access order, so consecutive keys do not share cache lines
+  unsigned seed = 1;
+  for (int i = 0; i < LOOKUPS; i++) {
+    seed = seed * 1103515245u + 12345u;
+    order[i] = keys[(seed >> 4) % key_count];
+    insert_values[i] = i;
+  }
+
+  ht_dyn_table_t table;
+  ht_dyn_init(&table, 0);
+  for (int i = 0; i < key_count; i++) {
+    ht_dyn_insert(&table, keys[i], i);
+  }
+
+  printf("Batch lookup and update - %i keys, %i operations\n", key_count,
+         LOOKUPS);
+  printf("-----------------------------------------------------\n");
+  printf("batch   get ns/key  insert ns/key\n");
+
+  double start = now_seconds();
+  for (int i = 0; i < LOOKUPS; i++) {
+    sink = *ht_dyn_get(&table, order[i]);
+  }
+  double single_get = now_seconds() - start;
+  start = now_seconds();
+  for (int i = 0; i < LOOKUPS; i++) {
+    ht_dyn_insert(&table, order[i], insert_values[i]);
+  }
+  double single_insert = now_seconds() - start;
+  printf("%-7s %10.1f %14.1f\n", "none", single_get * 1e9 / LOOKUPS,
+         single_insert * 1e9 / LOOKUPS);
+
+  for (int b = 0; b < sizeof(batch_sizes) / sizeof(batch_sizes[0]); b++) {
+    int batch = batch_sizes[b];
+
+    start = now_seconds();
+    for (int i = 0; i < LOOKUPS; i += batch) {
+      ht_dyn_get_batch(&table, order + i, values, batch);
+      sink = *values[0];
+    }
+    double get = now_seconds() - start;
+
+    start = now_seconds();
+    for (int i = 0; i < LOOKUPS; i += batch) {
+      ht_dyn_insert_batch(&table, order + i, insert_values + i, batch);
+    }
+    double insert = now_seconds() - start;
+
+    printf("%-7i %10.1f %14.1f\n", batch, get * 1e9 / LOOKUPS,
+           insert * 1e9 / LOOKUPS);
+  }
+
+  ht_dyn_free(&table);
+  free(insert_values);
+  free(order);
+  free(keys);
+}
+
+/* End of bench_batch.c */
@@ -0,0 +1,167 @@
+#include "hashtable_dyn.h"
+#include "ht_hash.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define KEY_COUNT 5040
+#define MAX_CHAIN 8
+#define AVALANCHE_BYTES 16
+#define AVALANCHE_TRIALS 1000
+
+typedef void (*key_generator_t)(int i, char *key);
+
+static double now_seconds() {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// "key0", "key1", ...
+void sequential_key(int i, char *key) { sprintf(key, "key%i", i); }
+
+// The i-th permutation of "abcdefg", all 5040 keys are anagrams
+void anagram_key(int i, char *key) {
+  char letters[] = "abcdefg";
+  int length = 7;
+  for (int pos = 0; pos < 7; pos++) {
+    int fact = 1;
+    for (int f = 2; f < length; f++) {
+      fact *= f;
+    }
+    int pick = i / fact;
+    i %= fact;
+    key[pos] = letters[pick];
+    memmove(&letters[pick], &letters[pick + 1], length - pick);
+    length--;
+  }
+  key[7] = '\0';
+}
+
+// Short keys of two or three lowercase letters
+void short_key(int i, char *key) {
+  key[0] = 'a' + i % 26;
+  key[1] = 'a' + (i / 26) % 26;
+  key[2] = i >= 26 * 26 ? 'a' + (i / (26 * 26)) % 26 : '\0';
+  key[3] = '\0';
+}
+
+void ht_dyn_print_histogram(ht_dyn_table_t *table) {
+  int histogram[MAX_CHAIN + 1] = {0};
+  int max_count = 0;
+  int sum_count = 0;
+
+  for (int i = 0; i < table->size; i++) {
+    int count = 0;
+    for (ht_item_t *item = table->items[i]; item != NULL; item = item->next) {
+      count++;
+    }
+    histogram[count < MAX_CHAIN ? count : MAX_CHAIN]++;
+    if (count > max_count) {
+      max_count = count;
+    }
+    sum_count += count;
+  }
+
+  printf("------------HASH TABLE--------------\n");
+  for (int i = 0; i <= MAX_CHAIN; i++) {
+    printf("%s%i: %6i buckets ", i == MAX_CHAIN ? ">=" : "  ", i, histogram[i]);
+    for (int bar = 0; bar < histogram[i] * 40 / table->size; bar++) {
+      printf("#");
+    }
+    printf("\n");
+  }
+  printf("------------------------------------\n");
+  printf("Total items in hash table: %i\n", sum_count);
+  printf("Maximum hash collisions: %i\n", max_count == 0 ? 0 : max_count - 1);
+  printf("------------------------------------\n");
+}
+
+void bench_distribution(const ht_hash_info_t *info, const char *set_name,
+                        key_generator_t generator) {
+  ht_dyn_table_t table;
+  char key[16];
+
+  // One bucket per key on average, growth disabled
+  ht_dyn_init(&table, KEY_COUNT);
+  table.max_load = 0;
+  ht_dyn_set_hash(&table, info->fn, NULL);
+
+  double start = now_seconds();
+  for (int i = 0; i < KEY_COUNT; i++) {
+    generator(i, key);
+    ht_dyn_insert(&table, key, i);
+  }
+  double elapsed = now_seconds() - start;
+
+  printf("[%s] %s keys, %i buckets, %.1f ns per insert\n", info->name,
+         set_name, table.size, elapsed * 1e9 / KEY_COUNT);
+  ht_dyn_print_histogram(&table);
+  printf("\n");
+  ht_dyn_free(&table);
+}
+
+// Flips every input bit and reports how far the flip probability of the
+// output bits is from the ideal 1/2.
+void bench_avalanche(const ht_hash_info_t *info) {
+  static int flips[AVALANCHE_BYTES * 8][64];
+  unsigned char data[AVALANCHE_BYTES];
+  const uint64_t seed[2] = {0x0123456789abcdef, 0xfedcba9876543210};
+  double total_bits = 0;
+
+  memset(flips, 0, sizeof(flips));
+  srand(42);
+  for (int trial = 0; trial < AVALANCHE_TRIALS; trial++) {
+    for (int i = 0; i < AVALANCHE_BYTES; i++) {
+      data[i] = rand() & 0xff;
+    }
+    uint64_t base = info->fn(data, AVALANCHE_BYTES, seed);
+    for (int bit = 0; bit < AVALANCHE_BYTES * 8; bit++) {
+      data[bit / 8] ^= 1 << (bit % 8);
+      uint64_t diff = base ^ info->fn(data, AVALANCHE_BYTES, seed);
+      data[bit / 8] ^= 1 << (bit % 8);
+      for (int out = 0; out < 64; out++) {
+        if ((diff >> out) & 1) {
+          flips[bit][out]++;
+          total_bits++;
+        }
+      }
+    }
+  }
+
+  double worst_bias = 0;
+  for (int bit = 0; bit < AVALANCHE_BYTES * 8; bit++) {
+    for (int out = 0; out < 64; out++) {
+      double bias = (double) flips[bit][out] / AVALANCHE_TRIALS - 0.5;
+      bias = bias < 0 ? -bias : bias;
+      if (bias > worst_bias) {
+        worst_bias = bias;
+      }
+    }
+  }
+  printf("[%s] avalanche: %.2f of 64 output bits flip on average, "
+         "worst bit bias %.3f\n",
+         info->name, total_bits / AVALANCHE_TRIALS / (AVALANCHE_BYTES * 8),
+         worst_bias);
+}
+
+int main(int argc, char *argv[]) {
+  printf("Hash Functions - distribution benchmark\n");
+  printf("---------------------------------------\n");
+  printf("\n");
+
+  for (const ht_hash_info_t *info = HT_HASH_FUNCTIONS; info->name != NULL;
+       info++) {
+    bench_distribution(info, "sequential", sequential_key);
+    bench_distribution(info, "anagram", anagram_key);
+    bench_distribution(info, "short", short_key);
+  }
+
+  for (const ht_hash_info_t *info = HT_HASH_FUNCTIONS; info->name != NULL;
+       info++) {
+    bench_avalanche(info);
+  }
+}
+
+/* End of bench_hash.c */
@@ -0,0 +1,84 @@
+#include "hashtable_dyn.h"
+#include "ht_intern.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define KEY_COUNT (1 << 18)
+#define LOOKUPS (1 << 22)
+#define KEY_LENGTH 48
+
+typedef char key_t_[KEY_LENGTH];
+
+static double now_seconds() {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Keeps the compiler from dropping the lookups
+volatile float sink;
+
+int main(int argc, char *argv[]) {
+  key_t_ *keys = malloc(KEY_COUNT * sizeof(key_t_));
+  char **canonical = malloc(KEY_COUNT * sizeof(char *));
+  ht_intern_pool_t pool;
+  ht_dyn_table_t plain, interned;
+
+  if (keys == NULL || canonical == NULL) {
+    return 1;
+  }
+  // Long, path-like keys, so hashing and comparing the bytes is not free
+  for (int i = 0; i < KEY_COUNT; i++) {
+    sprintf(keys[i], "/usr/share/project/resources/item-%08i", i);
+  }
+
+  ht_intern_init(&pool);
+  ht_dyn_init(&plain, 0);
+  ht_dyn_init_interned(&interned, 0, &pool);
+  for (int i = 0; i < KEY_COUNT; i++) {
+    ht_dyn_insert(&plain, keys[i], i);
+    ht_dyn_insert(&interned, keys[i], i);
+    canonical[i] = ht_intern_find(&pool, keys[i]);
+  }
+
+  printf("String vs. interned keys - %i keys of %i bytes, %i lookups\n",
+         KEY_COUNT, (int)strlen(keys[0]), LOOKUPS);
+  printf("------------------------------------------------------------\n");
+
+  unsigned seed = 1;
+  double start = now_seconds();
+  for (int i = 0; i < LOOKUPS; i++) {
+    seed = seed * 1103515245u + 12345u;
+    sink = ht_dyn_search(&plain, keys[seed % KEY_COUNT])->value;
+  }
+  printf("%-28s %6.1f ns\n", "strings (hash + strcmp)",
+         (now_seconds() - start) * 1e9 / LOOKUPS);
+
+  seed = 1;
+  start = now_seconds();
+  for (int i = 0; i < LOOKUPS; i++) {
+    seed = seed * 1103515245u + 12345u;
+    sink = ht_dyn_search(&interned, keys[seed % KEY_COUNT])->value;
+  }
+  printf("%-28s %6.1f ns\n", "interned, intern on lookup",
+         (now_seconds() - start) * 1e9 / LOOKUPS);
+
+  seed = 1;
+  start = now_seconds();
+  for (int i = 0; i < LOOKUPS; i++) {
+    seed = seed * 1103515245u + 12345u;
+    sink = ht_dyn_search_interned(&interned, canonical[seed % KEY_COUNT])->value;
+  }
+  printf("%-28s %6.1f ns\n", "interned, canonical pointer",
+         (now_seconds() - start) * 1e9 / LOOKUPS);
+
+  ht_dyn_free(&plain);
+  ht_dyn_free(&interned);
+  ht_intern_free(&pool);
+  free(canonical);
+  free(keys);
+}
+
+/* End of bench_intern.c */
@@ -0,0 +1,120 @@
+#include "hashtable_dyn.h"
+#include "hashtable_oa.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define SLOTS (1 << 20)
+#define KEY_LENGTH 16
+
+typedef char key_t_[KEY_LENGTH];
+
+static double now_seconds() {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Keeps the compiler from dropping the lookups
+volatile float sink;
+
+void bench_chained(key_t_ *keys, key_t_ *missing, int count, double *result) {
+  ht_dyn_table_t table;
+  ht_dyn_init(&table, SLOTS);
+  table.max_load = 0;
+  ht_dyn_set_hash(&table, ht_hash_xxh64, NULL);
+
+  double start = now_seconds();
+  for (int i = 0; i < count; i++) {
+    ht_dyn_insert(&table, keys[i], i);
+  }
+  result[0] = now_seconds() - start;
+
+  start = now_seconds();
+  for (int i = 0; i < count; i++) {
+    sink = *ht_dyn_get(&table, keys[i]);
+  }
+  result[1] = now_seconds() - start;
+
+  start = now_seconds();
+  for (int i = 0; i < count; i++) {
+    sink = ht_dyn_get(&table, missing[i]) != NULL;
+  }
+  result[2] = now_seconds() - start;
+
+  start = now_seconds();
+  for (int i = 0; i < count; i++) {
+    ht_dyn_delete(&table, keys[i]);
+  }
+  result[3] = now_seconds() - start;
+  ht_dyn_free(&table);
+}
+
+void bench_open_addressing(key_t_ *keys, key_t_ *missing, int count,
+                           double *result) {
+  ht_oa_table_t table;
+  ht_oa_init(&table, SLOTS);
+  table.max_load = 0;
+
+  double start = now_seconds();
+  for (int i = 0; i < count; i++) {
+    ht_oa_insert(&table, keys[i], i);
+  }
+  result[0] = now_seconds() - start;
+
+  start = now_seconds();
+  for (int i = 0; i < count; i++) {
+    sink = *ht_oa_get(&table, keys[i]);
+  }
+  result[1] = now_seconds() - start;
+
+  start = now_seconds();
+  for (int i = 0; i < count; i++) {
+    sink = ht_oa_get(&table, missing[i]) != NULL;
+  }
+  result[2] = now_seconds() - start;
+
+  start = now_seconds();
+  for (int i = 0; i < count; i++) {
+    ht_oa_delete(&table, keys[i]);
+  }
+  result[3] = now_seconds() - start;
+  ht_oa_free(&table);
+}
+
+void print_row(float load, const char *engine, double *result, int count) {
+  printf("%5.2f  %-8s %9.1f %9.1f %9.1f %9.1f\n", load, engine,
+         result[0] * 1e9 / count, result[1] * 1e9 / count,
+         result[2] * 1e9 / count, result[3] * 1e9 / count);
+}
+
+int main(int argc, char *argv[]) {
+  const float loads[] = {0.5f, 0.6f, 0.7f, 0.8f, 0.9f, 0.95f};
+  key_t_ *keys = malloc(SLOTS * sizeof(key_t_));
+  key_t_ *missing = malloc(SLOTS * sizeof(key_t_));
+  double result[4];
+
+  if (keys == NULL || missing == NULL) {
+    return 1;
+  }
+  for (int i = 0; i < SLOTS; i++) {
+    sprintf(keys[i], "key%i", i);
+    sprintf(missing[i], "miss%i", i);
+  }
+
+  printf("Chained vs. Robin Hood open addressing - %i slots\n", SLOTS);
+  printf("-----------------------------------------------------\n");
+  printf(" load  engine   insert ns    hit ns   miss ns delete ns\n");
+  for (int i = 0; i < sizeof(loads) / sizeof(loads[0]); i++) {
+    int count = (int)(loads[i] * SLOTS);
+    bench_chained(keys, missing, count, result);
+    print_row(loads[i], "chained", result, count);
+    bench_open_addressing(keys, missing, count, result);
+    print_row(loads[i], "robin", result, count);
+  }
+
+  free(keys);
+  free(missing);
+}
+
+/* End of bench_oa.c */
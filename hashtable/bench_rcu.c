@@ -0,0 +1,158 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "hashtable_rcu.h"
+#include "hashtable_shard.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#define KEY_COUNT (1 << 18)
+#define OPS_PER_THREAD (1 << 20)
+#define KEY_LENGTH 16
+// Every lock-free thread needs one of the reader slots
+#define MAX_THREADS HT_RCU_MAX_READERS
+
+// Percentage of operations that insert or delete
+#define WRITE_PERCENT 1
+
+typedef char key_t_[KEY_LENGTH];
+
+// Work of one benchmark thread
+typedef struct worker {
+  ht_rcu_table_t *rcu;
+  ht_shard_table_t *shard;
+  key_t_ *keys;
+  unsigned seed;
+  int ops; // operations done, 0 if the thread got no reader slot
+} worker_t;
+
+static double now_seconds() {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void *run_rcu(void *arg) {
+  worker_t *worker = arg;
+  int reader = ht_rcu_register(worker->rcu);
+  if (reader < 0) {
+    fprintf(stderr, "[W] No free reader slot, thread skipped\n");
+    return NULL;
+  }
+  unsigned seed = worker->seed;
+  float value;
+  for (int i = 0; i < OPS_PER_THREAD; i++) {
+    seed = seed * 1103515245u + 12345u;
+    char *key = worker->keys[(seed >> 8) % KEY_COUNT];
+    if ((int)(seed >> 4) % 100 < WRITE_PERCENT) {
+      if (i % 2 == 0) {
+        ht_rcu_delete(worker->rcu, key);
+      } else {
+        ht_rcu_insert(worker->rcu, key, i);
+      }
+    } else {
+      ht_rcu_get(worker->rcu, reader, key, &value);
+    }
+  }
+  ht_rcu_unregister(worker->rcu, reader);
+  worker->ops = OPS_PER_THREAD;
+  return NULL;
+}
+
+void *run_shard(void *arg) {
+  worker_t *worker = arg;
+  unsigned seed = worker->seed;
+  float value;
+  for (int i = 0; i < OPS_PER_THREAD; i++) {
+    seed = seed * 1103515245u + 12345u;
+    char *key = worker->keys[(seed >> 8) % KEY_COUNT];
+    if ((int)(seed >> 4) % 100 < WRITE_PERCENT) {
+      if (i % 2 == 0) {
+        ht_shard_delete(worker->shard, key);
+      } else {
+        ht_shard_insert(worker->shard, key, i);
+      }
+    } else {
+      ht_shard_get(worker->shard, key, &value);
+    }
+  }
+  worker->ops = OPS_PER_THREAD;
+  return NULL;
+}
+
+// Returns the throughput in millions of operations per second
+double run(void *(*body)(void *), worker_t *prototype, int threads) {
+  pthread_t ids[MAX_THREADS];
+  worker_t work[MAX_THREADS];
+
+  double start = now_seconds();
+  for (int t = 0; t < threads; t++) {
+    work[t] = *prototype;
+    work[t].seed = t + 1;
+    work[t].ops = 0;
+    pthread_create(&ids[t], NULL, body, &work[t]);
+  }
+  double ops = 0;
+  for (int t = 0; t < threads; t++) {
+    pthread_join(ids[t], NULL);
+    ops += work[t].ops;
+  }
+  return ops / (now_seconds() - start) / 1e6;
+}
+
+int main(int argc, char *argv[]) {
+  int cores = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  key_t_ *keys = malloc(KEY_COUNT * sizeof(key_t_));
+  ht_rcu_table_t *rcu = malloc(sizeof(ht_rcu_table_t));
+  ht_shard_table_t locked, sharded;
+
+  if (keys == NULL || rcu == NULL) {
+    return 1;
+  }
+  if (cores < 1) {
+    cores = 1;
+  }
+  if (cores > MAX_THREADS) {
+    cores = MAX_THREADS;
+  }
+  for (int i = 0; i < KEY_COUNT; i++) {
+    sprintf(keys[i], "key%i", i);
+  }
+
+  ht_rcu_init(rcu, KEY_COUNT);
+  ht_shard_init(&locked, 1, KEY_COUNT);
+  ht_shard_init(&sharded, 64, KEY_COUNT);
+  for (int i = 0; i < KEY_COUNT; i++) {
+    ht_rcu_insert(rcu, keys[i], i);
+    ht_shard_insert(&locked, keys[i], i);
+    ht_shard_insert(&sharded, keys[i], i);
+  }
+  worker_t rcu_work = {rcu, NULL, keys, 0, 0};
+  worker_t locked_work = {NULL, &locked, keys, 0, 0};
+  worker_t sharded_work = {NULL, &sharded, keys, 0, 0};
+
+  printf("Read-mostly scaling - %i keys, %i%% writes, %i ops per thread\n",
+         KEY_COUNT, WRITE_PERCENT, OPS_PER_THREAD);
+  printf("---------------------------------------------------------------\n");
+  printf("threads   rwlock x1  rwlock x64   lock-free   (Mops/s)\n");
+  // Thread counts double from 1 up to all cores
+  for (int threads = 1;; threads = threads * 2 < cores ? threads * 2 : cores) {
+    printf("%7i %11.2f %11.2f %11.2f\n", threads,
+           run(run_shard, &locked_work, threads),
+           run(run_shard, &sharded_work, threads),
+           run(run_rcu, &rcu_work, threads));
+    if (threads == cores) {
+      break;
+    }
+  }
+
+  ht_rcu_free(rcu);
+  ht_shard_free(&locked);
+  ht_shard_free(&sharded);
+  free(rcu);
+  free(keys);
+}
+
+/* End of bench_rcu.c */
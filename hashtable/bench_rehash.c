@@ -0,0 +1,72 @@
+#include "hashtable_dyn.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define KEY_COUNT (1 << 22)
+#define KEY_LENGTH 16
+
+typedef char key_t_[KEY_LENGTH];
+
+static double now_seconds() {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int compare_floats(const void *a, const void *b) {
+  float x = *(const float *)a;
+  float y = *(const float *)b;
+  return (x > y) - (x < y);
+}
+
+// Inserts all keys into a table growing from the default size, timing each call
+void bench_growth(const char *name, int migrate_step, key_t_ *keys,
+                  float *latencies) {
+  ht_dyn_table_t table;
+  ht_dyn_init(&table, 0);
+  table.migrate_step = migrate_step;
+
+  double total = now_seconds();
+  for (int i = 0; i < KEY_COUNT; i++) {
+    double start = now_seconds();
+    ht_dyn_insert(&table, keys[i], i);
+    latencies[i] = (float)((now_seconds() - start) * 1e9);
+  }
+  total = now_seconds() - total;
+  ht_dyn_free(&table);
+
+  qsort(latencies, KEY_COUNT, sizeof(float), compare_floats);
+  printf("%-14s %8.0f %8.0f %8.0f %9.0f %12.0f %9.2f\n", name,
+         latencies[KEY_COUNT / 2], latencies[(int)(KEY_COUNT * 0.99)],
+         latencies[(int)(KEY_COUNT * 0.999)],
+         latencies[(int)(KEY_COUNT * 0.9999)], latencies[KEY_COUNT - 1],
+         total);
+}
+
+int main(int argc, char *argv[]) {
+  key_t_ *keys = malloc(KEY_COUNT * sizeof(key_t_));
+  float *latencies = malloc(KEY_COUNT * sizeof(float));
+
+  if (keys == NULL || latencies == NULL) {
+    return 1;
+  }
+  for (int i = 0; i < KEY_COUNT; i++) {
+    sprintf(keys[i], "key%i", i);
+  }
+
+  printf("Insert latency while growing - %i keys, ns per insert\n",
+         KEY_COUNT);
+  printf("---------------------------------------------------------------------"
+         "\n");
+  printf("rehash              p50      p99     p999     p9999          max  "
+         "total s\n");
+  bench_growth("at once", 0, keys, latencies);
+  bench_growth("incremental 4", HT_DYN_MIGRATE_STEP, keys, latencies);
+  bench_growth("incremental 16", 16, keys, latencies);
+
+  free(latencies);
+  free(keys);
+}
+
+/* End of bench_rehash.c */
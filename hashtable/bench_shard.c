@@ -0,0 +1,120 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "hashtable_shard.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#define KEY_COUNT (1 << 18)
+#define OPS_PER_THREAD (1 << 20)
+#define KEY_LENGTH 16
+#define MAX_THREADS 256
+
+typedef char key_t_[KEY_LENGTH];
+
+// Work of one benchmark thread
+typedef struct worker {
+  ht_shard_table_t *table;
+  key_t_ *keys;
+  unsigned seed;
+  int write_percent;
+} worker_t;
+
+static double now_seconds() {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void *run_worker(void *arg) {
+  worker_t *worker = arg;
+  unsigned seed = worker->seed;
+  float value;
+  for (int i = 0; i < OPS_PER_THREAD; i++) {
+    seed = seed * 1103515245u + 12345u;
+    char *key = worker->keys[(seed >> 8) % KEY_COUNT];
+    if ((int)(seed >> 4) % 100 < worker->write_percent) {
+      ht_shard_insert(worker->table, key, i);
+    } else {
+      ht_shard_get(worker->table, key, &value);
+    }
+  }
+  return NULL;
+}
+
+// Returns the throughput in millions of operations per second
+double run(key_t_ *keys, int stripes, int threads, int write_percent) {
+  ht_shard_table_t table;
+  pthread_t ids[MAX_THREADS];
+  worker_t work[MAX_THREADS];
+
+  ht_shard_init(&table, stripes, KEY_COUNT);
+  for (int i = 0; i < KEY_COUNT; i++) {
+    ht_shard_insert(&table, keys[i], i);
+  }
+
+  double start = now_seconds();
+  for (int t = 0; t < threads; t++) {
+    work[t] = (worker_t){&table, keys, t + 1, write_percent};
+    pthread_create(&ids[t], NULL, run_worker, &work[t]);
+  }
+  for (int t = 0; t < threads; t++) {
+    pthread_join(ids[t], NULL);
+  }
+  double elapsed = now_seconds() - start;
+
+  ht_shard_free(&table);
+  return (double)threads * OPS_PER_THREAD / elapsed / 1e6;
+}
+
+int main(int argc, char *argv[]) {
+  const int write_percents[] = {0, 10, 50};
+  const int stripe_counts[] = {1, 16, 256};
+  int cores = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  key_t_ *keys = malloc(KEY_COUNT * sizeof(key_t_));
+
+  if (keys == NULL) {
+    return 1;
+  }
+  if (cores < 1) {
+    cores = 1;
+  }
+  if (cores > MAX_THREADS) {
+    cores = MAX_THREADS;
+  }
+  for (int i = 0; i < KEY_COUNT; i++) {
+    sprintf(keys[i], "key%i", i);
+  }
+
+  printf("Sharded table scaling - %i keys, %i ops per thread, %i cores\n",
+         KEY_COUNT, OPS_PER_THREAD, cores);
+  printf("--------------------------------------------------------------\n");
+  printf("writes threads   Mops/s by stripe count\n");
+  printf("              ");
+  for (int s = 0; s < sizeof(stripe_counts) / sizeof(stripe_counts[0]); s++) {
+    printf(" %9i", stripe_counts[s]);
+  }
+  printf("\n");
+
+  for (int w = 0; w < sizeof(write_percents) / sizeof(write_percents[0]);
+       w++) {
+    // Thread counts double from 1 up to all cores
+    for (int threads = 1;; threads = threads * 2 < cores ? threads * 2 : cores) {
+      printf("%5i%% %7i", write_percents[w], threads);
+      for (int s = 0; s < sizeof(stripe_counts) / sizeof(stripe_counts[0]);
+           s++) {
+        printf(" %9.2f", run(keys, stripe_counts[s], threads, write_percents[w]));
+      }
+      printf("\n");
+      if (threads == cores) {
+        break;
+      }
+    }
+  }
+
+  free(keys);
+}
+
+/* End of bench_shard.c */
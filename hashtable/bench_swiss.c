@@ -0,0 +1,98 @@
+#include "hashtable_dyn.h"
+#include "hashtable_oa.h"
+#include "hashtable_swiss.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define SLOTS (1 << 20)
+#define KEY_LENGTH 16
+
+typedef char key_t_[KEY_LENGTH];
+
+static double now_seconds() {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Keeps the compiler from dropping the lookups
+volatile int sink;
+
+#define BENCH_LOOKUPS(GET, TABLE, KEYS, COUNT, RESULT)                         \
+  do {                                                                         \
+    double start = now_seconds();                                              \
+    for (int i = 0; i < (COUNT); i++) {                                        \
+      sink = GET(TABLE, (KEYS)[i]) != NULL;                                    \
+    }                                                                          \
+    (RESULT) = (now_seconds() - start) * 1e9 / (COUNT);                        \
+  } while (0)
+
+void print_row(float load, const char *engine, double hit, double miss) {
+  printf("%5.3f  %-8s %9.1f %9.1f\n", load, engine, hit, miss);
+}
+
+int main(int argc, char *argv[]) {
+  const float loads[] = {0.5f, 0.75f, 0.875f};
+  key_t_ *keys = malloc(SLOTS * sizeof(key_t_));
+  key_t_ *missing = malloc(SLOTS * sizeof(key_t_));
+  double hit, miss;
+
+  if (keys == NULL || missing == NULL) {
+    return 1;
+  }
+  for (int i = 0; i < SLOTS; i++) {
+    sprintf(keys[i], "key%i", i);
+    sprintf(missing[i], "miss%i", i);
+  }
+
+#ifdef HT_SWISS_NO_SIMD
+  printf("Lookups - %i slots, scalar group matching\n", SLOTS);
+#else
+  printf("Lookups - %i slots, SSE2 group matching\n", SLOTS);
+#endif
+  printf("-------------------------------------------\n");
+  printf(" load  engine      hit ns   miss ns\n");
+  for (int l = 0; l < sizeof(loads) / sizeof(loads[0]); l++) {
+    int count = (int)(loads[l] * SLOTS);
+
+    ht_dyn_table_t chained;
+    ht_dyn_init(&chained, SLOTS);
+    chained.max_load = 0;
+    ht_dyn_set_hash(&chained, ht_hash_xxh64, NULL);
+    for (int i = 0; i < count; i++) {
+      ht_dyn_insert(&chained, keys[i], i);
+    }
+    BENCH_LOOKUPS(ht_dyn_get, &chained, keys, count, hit);
+    BENCH_LOOKUPS(ht_dyn_get, &chained, missing, count, miss);
+    print_row(loads[l], "chained", hit, miss);
+    ht_dyn_free(&chained);
+
+    ht_oa_table_t robin;
+    ht_oa_init(&robin, SLOTS);
+    robin.max_load = 0;
+    for (int i = 0; i < count; i++) {
+      ht_oa_insert(&robin, keys[i], i);
+    }
+    BENCH_LOOKUPS(ht_oa_get, &robin, keys, count, hit);
+    BENCH_LOOKUPS(ht_oa_get, &robin, missing, count, miss);
+    print_row(loads[l], "robin", hit, miss);
+    ht_oa_free(&robin);
+
+    ht_swiss_table_t swiss;
+    ht_swiss_init(&swiss, SLOTS);
+    swiss.max_load = 0;
+    for (int i = 0; i < count; i++) {
+      ht_swiss_insert(&swiss, keys[i], i);
+    }
+    BENCH_LOOKUPS(ht_swiss_get, &swiss, keys, count, hit);
+    BENCH_LOOKUPS(ht_swiss_get, &swiss, missing, count, miss);
+    print_row(loads[l], "swiss", hit, miss);
+    ht_swiss_free(&swiss);
+  }
+
+  free(keys);
+  free(missing);
+}
+
+/* End of bench_swiss.c */
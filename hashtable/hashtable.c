@@ -89,13 +89,110 @@ char *strdup(const char *s) {
     return duplicate;                       // Return the new string
 }
 
+/**
+ * @brief Stores a copy of the key in the item.
+ * 
+ * @details Keys that fit into the item's inline buffer (`HT_INLINE_KEY_SIZE` bytes, the
+ *          terminating null byte included) are copied there, so that the item and its key
+ *          share one allocation and usually one cache line; comparing the key in `ht_search`
+ *          then does not touch another memory block. Longer keys are duplicated on the heap.
+ *          In both cases 'item->key' points to the copy, so readers of the key do not need
+ *          to know where it is stored.
+ * 
+ * @param item A pointer to the item whose key is to be set.
+ * @param key The key to be copied.
+ * 
+ * @pre 'key' must be a valid null-terminated string.
+ * 
+ * @post On success, 'item->key' points to a copy of 'key' that must be released with
+ *       `ht_item_free_key`.
+ * 
+ * @code
+ * ht_item_t *item = malloc(sizeof(ht_item_t));
+ * ht_item_set_key(item, "short");  // stored inline
+ * ht_item_free_key(item);          // no-op for inline keys
+ * free(item);
+ * @endcode
+ * 
+ * @warning The item must not be copied by value while it holds an inline key, the copy's
+ *          'key' would still point into the original item.
+ * 
+ * @retval true The key was stored.
+ * @retval false 'item' is NULL or memory allocation failed.
+ */
+bool ht_item_set_key(ht_item_t *item, const char *key) {
+
+    // Check for NULL
+    if (item == NULL) {
+        return false;
+    }
+
+    size_t length = strlen(key) + 1;
+    // Short key, store it in the item
+    if (length <= HT_INLINE_KEY_SIZE) {
+        memcpy(item->inline_key, key, length);
+        item->key = item->inline_key;
+        return true;
+    }
+    // Long key, store it out of line
+    item->key = strdup(key);
+    return item->key != NULL;
+}
+
+/**
+ * @brief Releases the key stored in the item by `ht_item_set_key`.
+ * 
+ * @details Frees the key only if it lives out of line; inline keys are released together
+ *          with the item.
+ * 
+ * @param item A pointer to the item whose key is to be released.
+ * 
+ * @return This function does not return a value.
+ */
+void ht_item_free_key(ht_item_t *item) {
+    if (item != NULL && item->key != item->inline_key) {
+        free(item->key);
+    }
+}
+
+/**
+ * @brief Computes the full (unreduced) hash value of a string key.
+ * 
+ * @details Sums the character codes of the key, starting from 1. `get_hash` reduces the
+ *          result to a table index, and the table items keep the unreduced value, so that
+ *          walking a synonym list compares integers first and calls `strcmp` only for
+ *          items whose full hash matches.
+ * 
+ * @param key The string key for which the hash value is to be computed.
+ * 
+ * @pre 'key' must be a valid null-terminated string.
+ * 
+ * @note Keys with equal full hashes (e.g. anagrams) still need the string comparison.
+ * 
+ * @code
+ * int full = get_full_hash("example");
+ * int index = full % HT_SIZE; // same as get_hash("example")
+ * @endcode
+ * 
+ * @retval The full hash value for the given key.
+ */
+static int get_full_hash(char *key) {
+    int result = 1;
+    int length = strlen(key);
+    for (int i = 0; i < length; i++) {
+        result += key[i];
+    }
+    return result;
+}
+
 /**
  * @brief Computes a hash value for a given string key.
  * 
  * @details The hash function takes a string key and computes a hash value, which
  *          is an index in the interval [0, HT_SIZE - 1]. The function sums the ASCII
- *          values of the characters in the key and then takes the modulus with the size
- *          of the hash table to ensure the result fits within the table's bounds.
+ *          values of the characters in the key (see `get_full_hash`) and then takes the
+ *          modulus with the size of the hash table to ensure the result fits within the
+ *          table's bounds.
  * 
  * @param key The string key for which the hash value is to be computed.
  * 
@@ -120,12 +217,7 @@ char *strdup(const char *s) {
  * @retval The computed hash value for the given key.
  */
 int get_hash(char *key) {
-    int result = 1;
-    int length = strlen(key);
-    for (int i = 0; i < length; i++) {
-        result += key[i];
-    }
-    return (result % HT_SIZE);
+    return (get_full_hash(key) % HT_SIZE);
 }
 
 /**
@@ -171,6 +263,8 @@ void ht_init(ht_table_t *table) {
  * @details Traverses the hashtable looking for an item that matches the provided key.
  *          If found, it returns a pointer to the item. Otherwise, it returns NULL.
  *          The search is conducted within the linked list at the index determined by the hash function.
+ *          Every item stores the full hash of its key, so the keys are compared by value with
+ *          `strcmp` only when the full hashes are equal.
  * 
  * @param table A pointer to the hashtable.
  * @param key The key of the item to search for.
@@ -189,9 +283,6 @@ void ht_init(ht_table_t *table) {
  * ht_item_t *item = ht_search(&my_table, "my_key");
  * @endcode
  * 
- * @todo Ensure that the comparison of keys is done correctly, considering the possibility of
- *       string interning.
- * 
  * @warning If 'table' is NULL or not properly initialized, the function may return incorrect results.
  * 
  * @retval NULL The key was not found or 'table' is NULL.
@@ -204,15 +295,16 @@ ht_item_t *ht_search(ht_table_t *table, char *key) {
         return NULL;
     }
 
-    // Getting an index from the table
-    int index = get_hash(key);
+    // Getting the full hash and the index from the table
+    int hash = get_full_hash(key);
+    int index = hash % HT_SIZE;
     // Storing a pointer to the cell with our index
     ht_item_t *cellElement = (*table)[index];
 
     // Loop until we go through the entire cell
     while (cellElement != NULL) {
-        // If the keys match
-        if (cellElement->key == key) {
+        // If the hashes and then the keys match
+        if (cellElement->hash == (uint64_t) hash && strcmp(cellElement->key, key) == 0) {
             return cellElement;
         }
         // Moving further in the cell
@@ -274,13 +366,13 @@ void ht_insert(ht_table_t *table, char *key, float value) {
         if (newElement == NULL) {
             return;
         }
-        newElement->key = strdup(key);
-        if (newElement->key == NULL) {
+        if (!ht_item_set_key(newElement, key)) {
             free(newElement);
             return;
         }
         newElement->value = value;
         newElement->next = NULL;
+        newElement->hash = (uint64_t) get_full_hash(key);
 
         // Getting an index from the table
         int index = get_hash(key);
@@ -354,7 +446,8 @@ float *ht_get(ht_table_t *table, char *key) {
  * @brief Removes an item with a specified key from the hashtable.
  * 
  * @details Searches for and, if found, deletes the item from the hashtable that matches the provided key.
- *          If the item exists, all associated memory is released. The item's removal is performed
+ *          If the item exists, all associated memory (the item and its key) is released. As in
+ *          `ht_search`, the stored full hashes are compared before the keys. The item's removal is performed
  *          directly without using the `ht_search` function to navigate the hashtable.
  * 
  * @param table A pointer to the hashtable.
@@ -386,19 +479,18 @@ void ht_delete(ht_table_t *table, char *key) {
         return;
     }
 
-    // Getting an index from the table
-    int index = get_hash(key);
+    // Getting the full hash and the index from the table
+    int hash = get_full_hash(key);
+    int index = hash % HT_SIZE;
     // Storing a pointer to the cell with our index
     ht_item_t *cellElement = (*table)[index];
     // Storing a pointer to the previous cell item
     ht_item_t *prevCellElement = NULL;
 
-    bool isDeleted = false;
-
     // Loop until the item is deleted or not found (if it's in the table)
-    while (!isDeleted && cellElement != NULL) {
+    while (cellElement != NULL) {
         // If found
-        if (cellElement->key == key) {
+        if (cellElement->hash == (uint64_t) hash && strcmp(cellElement->key, key) == 0) {
             // If it's the first in the cell
             if (prevCellElement == NULL) {
                 // Update the start of the cell
@@ -407,10 +499,10 @@ void ht_delete(ht_table_t *table, char *key) {
             else {// It's not the first
                 prevCellElement->next = cellElement->next;
             }
-            // Free the item
+            // Free the item and its key
+            ht_item_free_key(cellElement);
             free(cellElement);
-            // Mark as deleted
-            isDeleted = true;
+            return;
         }
         // Updating pointers for navigating the cell
         prevCellElement = cellElement;
@@ -457,7 +549,7 @@ void ht_delete_all(ht_table_t *table) {
         // Looping through each item in the cell and deleting it
         while (current != NULL) {
             ht_item_t *nextItem = current->next;
-            free(current->key);
+            ht_item_free_key(current);
             free(current);
             current = nextItem;
         }
@@ -7,6 +7,7 @@
 #define IAL_HASHTABLE_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
 /*
  * Maximum array size for the table implementation.
@@ -21,16 +22,26 @@
  */
 extern int HT_SIZE;
 
+/*
+ * Keys shorter than HT_INLINE_KEY_SIZE (terminating null byte included)
+ * are stored inside the item itself instead of a separate allocation.
+ */
+#define HT_INLINE_KEY_SIZE 16
+
 // Table item
 typedef struct ht_item {
   char *key;            // key
   float value;          // value
   struct ht_item *next; // pointer to the next synonym
+  uint64_t hash;        // full hash of the key, compared before the key itself
+  char inline_key[HT_INLINE_KEY_SIZE]; // storage of short keys, 'key' points here
 } ht_item_t;
 
 // Table with the actual size of MAX_HT_SIZE
 typedef ht_item_t *ht_table_t[MAX_HT_SIZE];
 
+bool ht_item_set_key(ht_item_t *item, const char *key);
+void ht_item_free_key(ht_item_t *item);
 int get_hash(char *key);
 void ht_init(ht_table_t *table);
 ht_item_t *ht_search(ht_table_t *table, char *key);
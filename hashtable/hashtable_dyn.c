@@ -0,0 +1,1330 @@
+/**
+ * @file hashtable_dyn.c
+ * @brief Growable hashtable with explicitly linked synonyms.
+ * @details Implements a hashtable whose bucket array is allocated on the heap and
+ *          grows as items are inserted. The synonym lists use the same `ht_item_t`
+ *          items as the fixed-size table in hashtable.c. Whenever an insertion would
+ *          push the load factor (items per bucket) over `max_load`, all items are
+ *          relinked into a bucket array whose size is the next prime number at least
+ *          twice as large, so the expected chain length stays constant and lookups
+ *          remain O(1) as the table grows.
+ *
+ *          In arena mode (`ht_dyn_init_arena`), items and key bytes are carved out of
+ *          large slabs (see ht_arena.c) instead of two `malloc` calls per insertion.
+ *          Items inserted one after another then lie next to each other, deleted items
+ *          are recycled through a free list, and `ht_dyn_delete_all`/`ht_dyn_free` release
+ *          the memory in O(number of slabs) instead of one `free` per item and key.
+ *
+ *          In interned mode (`ht_dyn_init_interned`), the keys are canonical strings of an
+ *          interning pool (see ht_intern.c). Items point to them instead of holding a copy,
+ *          and keys are hashed by their address and compared with `==`, so
+ *          `ht_dyn_search_interned` never reads the key bytes.
+ *
+ *          Growing rehashes all items at once by default, which makes the insertion that
+ *          triggers it as slow as all previous ones together. With a positive `migrate_step`,
+ *          the table grows incrementally instead: the new bucket array is allocated, the old
+ *          one is kept, and every following insertion and deletion moves the items of
+ *          `migrate_step` old buckets into the new array. Until the old array is empty,
+ *          lookups check both arrays and new items go into the new one. The cost of a single
+ *          operation therefore stays bounded while the table grows.
+ *
+ *          Lookups (`ht_dyn_search`, `ht_dyn_search_interned`, `ht_dyn_get`,
+ *          `ht_dyn_get_batch`) never modify the table, so any number of them may run
+ *          concurrently as long as no insertion, deletion or resize runs at the same time.
+ *
+ *          The batch functions (`ht_dyn_insert_batch`, `ht_dyn_get_batch`) handle keys in
+ *          groups of HT_DYN_BATCH_GROUP: all keys of a group are hashed and their buckets
+ *          prefetched, then the bucket heads are loaded and prefetched, and only then are
+ *          the synonym lists walked. The cache misses of a group thus overlap instead of
+ *          stalling each lookup in turn, which pays off once the table outgrows the cache.
+ *
+ *          The `_hashed` functions take the hash of the key from the caller, which must
+ *          have computed it with the table's hash function and seed. A caller that needs
+ *          the hash anyway, like the sharded table choosing a stripe, so hashes each key
+ *          only once.
+ *
+ *          Key functions implemented:
+ *          - ht_dyn_init: Allocates the bucket array of the table.
+ *          - ht_dyn_init_arena: Same, with items and keys allocated from slabs.
+ *          - ht_dyn_init_interned: Same, with keys taken from an interning pool.
+ *          - ht_dyn_search: Searches for an item in the table.
+ *          - ht_dyn_search_interned: Searches for a canonical key by its address.
+ *          - ht_dyn_search_hashed: Searches for a key whose hash the caller computed.
+ *          - ht_dyn_insert: Inserts a new item or updates an existing one.
+ *          - ht_dyn_insert_hashed: Same, for a key whose hash the caller computed.
+ *          - ht_dyn_get: Retrieves an item's value from the table.
+ *          - ht_dyn_insert_batch: Inserts or updates many items with prefetching.
+ *          - ht_dyn_get_batch: Retrieves the values of many keys with prefetching.
+ *          - ht_dyn_delete: Removes an item from the table.
+ *          - ht_dyn_delete_hashed: Same, for a key whose hash the caller computed.
+ *          - ht_dyn_delete_all: Deletes all items from the table.
+ *          - ht_dyn_free: Deletes all items and releases the bucket array.
+ *          - ht_dyn_resize: Rehashes the table into a new bucket array.
+ *          - ht_dyn_set_hash: Selects the hash function of the table.
+ *
+ * @code
+ * ht_dyn_table_t my_table;
+ * ht_dyn_init(&my_table, 0);
+ * ht_dyn_insert(&my_table, "key1", 1.0f);
+ * float *value = ht_dyn_get(&my_table, "key1");
+ * if (value) {
+ *     printf("Found value: %f\n", *value);
+ * }
+ * ht_dyn_free(&my_table);
+ * @endcode
+ *
+ * @see hashtable_dyn.h for type definitions and constants.
+ * @see hashtable.c for the fixed-size variant of the table.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project02-2021 for the project repository.
+ */
+
+#include "hashtable_dyn.h"
+#include "ht_intern.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Prefetch hint used by the batch functions, a no-op without the GCC builtin
+#if defined(__GNUC__)
+#define HT_DYN_PREFETCH(ADDRESS) __builtin_prefetch(ADDRESS)
+#else
+#define HT_DYN_PREFETCH(ADDRESS) ((void) (ADDRESS))
+#endif
+
+/**
+ * @brief Computes the full hash of a key with the table's hash function and seed.
+ *
+ * @details In interned mode, the address of the canonical key is hashed instead of its
+ *          bytes; a multiplication by the 64-bit golden ratio spreads the aligned
+ *          addresses over all buckets.
+ *
+ * @param table A pointer to an initialized table.
+ * @param key The string key to hash, a canonical key in interned mode.
+ *
+ * @pre 'key' must be a valid null-terminated string.
+ *
+ * @return The 64-bit hash value; the bucket index is the value reduced by the table size.
+ */
+static inline uint64_t ht_dyn_hash_key(ht_dyn_table_t *table, const char *key) {
+    if (table->intern != NULL) {
+        return (uint64_t) (uintptr_t) key * 0x9E3779B97F4A7C15ULL;
+    }
+    return table->hash(key, strlen(key), table->seed);
+}
+
+/**
+ * @brief Tells whether a stored key is equal to the searched one.
+ *
+ * @details Canonical keys of an interned table are equal exactly when their addresses
+ *          are; otherwise the strings are compared.
+ *
+ * @param table A pointer to an initialized table.
+ * @param stored The key of an item of the table.
+ * @param key The searched key, a canonical key in interned mode.
+ *
+ * @retval true The keys are equal.
+ * @retval false The keys differ.
+ */
+static inline bool ht_dyn_key_equals(ht_dyn_table_t *table, const char *stored,
+                                     const char *key) {
+    if (table->intern != NULL) {
+        return stored == key;
+    }
+    return strcmp(stored, key) == 0;
+}
+
+/**
+ * @brief Maps a key to the key the table stores.
+ *
+ * @details Returns 'key' itself, or in interned mode its canonical copy in the pool.
+ *          With 'add' set, a key missing from the pool is interned on the fly; otherwise
+ *          NULL is returned for it, since such a key cannot be in the table.
+ *
+ * @param table A pointer to an initialized table.
+ * @param key The key passed by the caller.
+ * @param add Whether a key missing from the pool is added to it.
+ *
+ * @retval NULL The key is not interned (or interning failed).
+ * @return The key to search for.
+ */
+static char *ht_dyn_table_key(ht_dyn_table_t *table, char *key, bool add) {
+    if (table->intern == NULL) {
+        return key;
+    }
+    return add ? ht_intern(table->intern, key) : ht_intern_find(table->intern, key);
+}
+
+/**
+ * @brief Walks a synonym list looking for a key with the given full hash.
+ *
+ * @details Compares the stored hashes first and calls `strcmp` only for items whose
+ *          hash is equal to 'hash', which for a good hash function means almost only
+ *          for the searched item itself.
+ *
+ * @param table A pointer to an initialized table.
+ * @param cellElement The first item of the synonym list.
+ * @param key The key to search for.
+ * @param hash The full hash of 'key'.
+ *
+ * @retval NULL The key is not in the list.
+ * @return A pointer to the found item.
+ */
+static ht_item_t *ht_dyn_walk(ht_dyn_table_t *table, ht_item_t *cellElement,
+                              const char *key, uint64_t hash) {
+    while (cellElement != NULL) {
+        if (cellElement->hash == hash && ht_dyn_key_equals(table, cellElement->key, key)) {
+            return cellElement;
+        }
+        cellElement = cellElement->next;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Searches the synonym list of the bucket selected by the full hash of a key.
+ *
+ * @param table A pointer to an initialized table.
+ * @param key The key to search for.
+ * @param hash The full hash of 'key'.
+ *
+ * @retval NULL The key is not in the table.
+ * @return A pointer to the found item.
+ */
+static ht_item_t *ht_dyn_find(ht_dyn_table_t *table, const char *key, uint64_t hash) {
+    ht_item_t *item = ht_dyn_walk(table, table->items[hash % (uint64_t) table->size], key, hash);
+    // Buckets not migrated yet still hold items
+    if (item == NULL && table->old_items != NULL) {
+        item = ht_dyn_walk(table, table->old_items[hash % (uint64_t) table->old_size], key, hash);
+    }
+    return item;
+}
+
+/**
+ * @brief Moves the items of up to 'buckets' non-empty old buckets into the new array.
+ *
+ * @details Continues the incremental rehash from `migrate_index`. Empty old buckets do
+ *          not count against 'buckets', but at most HT_DYN_MIGRATE_EMPTY_VISITS of them
+ *          are skipped per bucket, so a sparse old array cannot make one call slow. The
+ *          items are relinked by the full hash stored in them. When the last old bucket
+ *          is migrated, the old array is released.
+ *
+ * @param table A pointer to an initialized table.
+ * @param buckets The maximum number of non-empty buckets to migrate.
+ *
+ * @return This function does not return a value.
+ */
+static void ht_dyn_migrate(ht_dyn_table_t *table, int buckets) {
+    if (table->old_items == NULL) {
+        return;
+    }
+
+    long long emptyVisits = (long long) buckets * HT_DYN_MIGRATE_EMPTY_VISITS;
+    while (buckets > 0 && table->migrate_index < table->old_size) {
+        ht_item_t *current = table->old_items[table->migrate_index];
+        if (current == NULL) {
+            table->migrate_index++;
+            if (--emptyVisits <= 0) {
+                break;
+            }
+            continue;
+        }
+        // Relink each item to the front of its new synonym list
+        while (current != NULL) {
+            ht_item_t *nextItem = current->next;
+            int index = (int) (current->hash % (uint64_t) table->size);
+            current->next = table->items[index];
+            table->items[index] = current;
+            current = nextItem;
+        }
+        table->old_items[table->migrate_index++] = NULL;
+        buckets--;
+    }
+
+    if (table->migrate_index >= table->old_size) {
+        free(table->old_items);
+        table->old_items = NULL;
+        table->old_size = 0;
+        table->migrate_index = 0;
+    }
+}
+
+/**
+ * @brief Performs the incremental rehash step of one operation.
+ *
+ * @param table A pointer to an initialized table.
+ *
+ * @return This function does not return a value.
+ */
+static inline void ht_dyn_migrate_step(ht_dyn_table_t *table) {
+    if (table->old_items != NULL) {
+        ht_dyn_migrate(table, table->migrate_step > 0 ? table->migrate_step : 1);
+    }
+}
+
+/**
+ * @brief Completes an incremental rehash in progress, if any.
+ *
+ * @param table A pointer to an initialized table.
+ *
+ * @post All items are in 'table->items'.
+ *
+ * @return This function does not return a value.
+ */
+static void ht_dyn_finish_migration(ht_dyn_table_t *table) {
+    while (table->old_items != NULL) {
+        ht_dyn_migrate(table, table->old_size);
+    }
+}
+
+/**
+ * @brief Starts an incremental rehash into a new bucket array.
+ *
+ * @details Replaces the bucket array by an empty one with the smallest prime number of
+ *          buckets that is at least 'size' and keeps the current array as the old one,
+ *          to be migrated by the following operations. A migration still in progress is
+ *          completed first.
+ *
+ * @param table A pointer to an initialized table.
+ * @param size The requested number of buckets.
+ *
+ * @retval true The migration was started.
+ * @retval false The new bucket array could not be allocated; the table is unchanged.
+ */
+static bool ht_dyn_start_migration(ht_dyn_table_t *table, int size) {
+    ht_dyn_finish_migration(table);
+
+    size = ht_dyn_next_prime(size);
+    ht_item_t **newItems = calloc(size, sizeof(ht_item_t *));
+    if (newItems == NULL) {
+        return false;
+    }
+    table->old_items = table->items;
+    table->old_size = table->size;
+    table->migrate_index = 0;
+    table->items = newItems;
+    table->size = size;
+    return true;
+}
+
+/**
+ * @brief Returns the smallest prime number that is greater than or equal to 'n'.
+ *
+ * @details Uses trial division by odd numbers, which is cheap compared to the rehash
+ *          that follows it. Values smaller than 2 yield 2.
+ *
+ * @param n The lower bound for the prime number.
+ *
+ * @code
+ * int size = ht_dyn_next_prime(2 * 101); // 211
+ * @endcode
+ *
+ * @return The smallest prime number >= 'n'.
+ */
+int ht_dyn_next_prime(int n) {
+    if (n <= 2) {
+        return 2;
+    }
+    // Even numbers above 2 are never prime
+    if (n % 2 == 0) {
+        n++;
+    }
+    for (;; n += 2) {
+        bool isPrime = true;
+        for (int d = 3; (long long) d * d <= n; d += 2) {
+            if (n % d == 0) {
+                isPrime = false;
+                break;
+            }
+        }
+        if (isPrime) {
+            return n;
+        }
+    }
+}
+
+/**
+ * @brief Initializes a growable hashtable.
+ *
+ * @details Allocates a bucket array with a prime number of buckets (at least 'size',
+ *          or HT_DYN_DEFAULT_SIZE when 'size' is not positive) and sets all of them to NULL.
+ *          The load factor limit is set to HT_DYN_MAX_LOAD and can be changed afterwards
+ *          through the `max_load` member, incremental growth is enabled by setting the
+ *          `migrate_step` member (e.g. to HT_DYN_MIGRATE_STEP); the keys are hashed by HT_DYN_DEFAULT_HASH
+ *          until `ht_dyn_set_hash` selects another function.
+ *
+ * @param table A pointer to the table to be initialized.
+ * @param size The requested initial number of buckets.
+ *
+ * @pre 'table' must not reference an initialized table, otherwise its memory is leaked.
+ *
+ * @post On success, the table is empty and ready for use.
+ *
+ * @code
+ * ht_dyn_table_t my_table;
+ * if (!ht_dyn_init(&my_table, 1000)) {
+ *     // handle allocation failure
+ * }
+ * @endcode
+ *
+ * @warning The table must be released with `ht_dyn_free` to avoid memory leaks.
+ *
+ * @retval true The table was initialized.
+ * @retval false 'table' is NULL or the bucket array could not be allocated.
+ */
+bool ht_dyn_init(ht_dyn_table_t *table, int size) {
+
+    // Check for NULL
+    if (table == NULL) {
+        return false;
+    }
+
+    table->use_arena = false;
+    ht_arena_init(&table->item_arena, 0);
+    ht_arena_init(&table->key_arena, 0);
+    table->free_items = NULL;
+    table->intern = NULL;
+    table->migrate_step = 0;
+    table->old_items = NULL;
+    table->old_size = 0;
+    table->migrate_index = 0;
+
+    size = ht_dyn_next_prime(size > 0 ? size : HT_DYN_DEFAULT_SIZE);
+    table->items = calloc(size, sizeof(ht_item_t *));
+    if (table->items == NULL) {
+        table->size = 0;
+        table->count = 0;
+        return false;
+    }
+    table->size = size;
+    table->count = 0;
+    table->max_load = HT_DYN_MAX_LOAD;
+    table->hash = HT_DYN_DEFAULT_HASH;
+    table->seed[0] = 0;
+    table->seed[1] = 0;
+    return true;
+}
+
+/**
+ * @brief Initializes a growable hashtable in arena mode.
+ *
+ * @details Works like `ht_dyn_init`, but the items and the copies of the keys inserted
+ *          later are allocated from slabs: items from one arena, so that they sit
+ *          contiguously, and key bytes from another. Deleted items are reused by later
+ *          insertions; the bytes of their keys are reclaimed only when the whole table
+ *          is emptied.
+ *
+ * @param table A pointer to the table to be initialized.
+ * @param size The requested initial number of buckets.
+ *
+ * @pre 'table' must not reference an initialized table, otherwise its memory is leaked.
+ *
+ * @post On success, the table is empty and ready for use.
+ *
+ * @code
+ * ht_dyn_table_t my_table;
+ * ht_dyn_init_arena(&my_table, 1 << 20);
+ * // ... millions of insertions ...
+ * ht_dyn_free(&my_table); // one free per slab
+ * @endcode
+ *
+ * @note Suited for tables that are filled and torn down as a whole. Workloads that delete
+ *       and re-insert many long keys accumulate unused key bytes until `ht_dyn_delete_all`.
+ *
+ * @retval true The table was initialized.
+ * @retval false 'table' is NULL or the bucket array could not be allocated.
+ */
+bool ht_dyn_init_arena(ht_dyn_table_t *table, int size) {
+    if (!ht_dyn_init(table, size)) {
+        return false;
+    }
+    table->use_arena = true;
+    return true;
+}
+
+/**
+ * @brief Initializes a growable hashtable in interned mode.
+ *
+ * @details Works like `ht_dyn_init`, but the keys are canonical strings of 'pool'. The
+ *          items point to them instead of holding a copy, and keys are hashed by address
+ *          and compared with `==`. `ht_dyn_insert` interns new keys on the fly, while
+ *          `ht_dyn_search`, `ht_dyn_get` and `ht_dyn_delete` look the key up in the pool
+ *          first and accept any string. Callers holding canonical pointers skip that step
+ *          with `ht_dyn_search_interned`.
+ *
+ * @param table A pointer to the table to be initialized.
+ * @param size The requested initial number of buckets.
+ * @param pool The pool of the keys, NULL for `ht_intern_default()`.
+ *
+ * @pre 'table' must not reference an initialized table, otherwise its memory is leaked.
+ *
+ * @post On success, the table is empty and ready for use.
+ *
+ * @code
+ * ht_dyn_table_t my_table;
+ * ht_dyn_init_interned(&my_table, 0, NULL);
+ * ht_dyn_insert(&my_table, "key1", 1.0f);
+ * char *key = ht_intern(ht_intern_default(), "key1"); // once, outside the hot path
+ * ht_item_t *item = ht_dyn_search_interned(&my_table, key); // no hashing of the bytes
+ * @endcode
+ *
+ * @warning The pool must outlive the table.
+ *
+ * @retval true The table was initialized.
+ * @retval false 'table' is NULL, no pool is available or the bucket array could not be
+ *         allocated.
+ */
+bool ht_dyn_init_interned(ht_dyn_table_t *table, int size, ht_intern_pool_t *pool) {
+    if (pool == NULL) {
+        pool = ht_intern_default();
+        if (pool == NULL) {
+            return false;
+        }
+    }
+    if (!ht_dyn_init(table, size)) {
+        return false;
+    }
+    table->intern = pool;
+    return true;
+}
+
+/**
+ * @brief Allocates a new item together with a copy of its key.
+ *
+ * @details Keys shorter than `HT_INLINE_KEY_SIZE` are stored inside the item. In arena
+ *          mode, a recycled item is preferred over a new slab allocation and longer keys
+ *          are copied into the key arena. Otherwise both come from `malloc`. In interned
+ *          mode, the item references the canonical key and nothing is copied.
+ *
+ * @param table A pointer to an initialized table.
+ * @param key The key to be copied into the item, a canonical key in interned mode.
+ *
+ * @retval NULL Allocation failed.
+ * @return A pointer to the item; only its key is set.
+ */
+static ht_item_t *ht_dyn_new_item(ht_dyn_table_t *table, const char *key) {
+    ht_item_t *item;
+
+    if (table->use_arena) {
+        if (table->free_items != NULL) {
+            item = table->free_items;
+            table->free_items = item->next;
+        }
+        else {
+            item = ht_arena_alloc(&table->item_arena, sizeof(ht_item_t));
+            if (item == NULL) {
+                return NULL;
+            }
+        }
+        if (table->intern != NULL) {
+            item->key = (char *) key;
+            return item;
+        }
+        // Short keys are stored in the item, long ones in the key arena
+        if (strlen(key) < HT_INLINE_KEY_SIZE) {
+            ht_item_set_key(item, key);
+            return item;
+        }
+        item->key = ht_arena_strdup(&table->key_arena, key);
+        if (item->key == NULL) {
+            item->next = table->free_items;
+            table->free_items = item;
+            return NULL;
+        }
+        return item;
+    }
+
+    item = malloc(sizeof(ht_item_t));
+    if (item == NULL) {
+        return NULL;
+    }
+    if (table->intern != NULL) {
+        item->key = (char *) key;
+        return item;
+    }
+    if (!ht_item_set_key(item, key)) {
+        free(item);
+        return NULL;
+    }
+    return item;
+}
+
+/**
+ * @brief Releases an item unlinked from the table.
+ *
+ * @details In arena mode, the item is pushed onto the free list for reuse; otherwise
+ *          the item and its key are freed. Canonical keys of interned mode belong to the
+ *          pool and are never freed here.
+ *
+ * @param table A pointer to an initialized table.
+ * @param item The item to release.
+ *
+ * @return This function does not return a value.
+ */
+static void ht_dyn_release_item(ht_dyn_table_t *table, ht_item_t *item) {
+    if (table->use_arena) {
+        item->next = table->free_items;
+        table->free_items = item;
+        return;
+    }
+    if (table->intern == NULL) {
+        ht_item_free_key(item);
+    }
+    free(item);
+}
+
+/**
+ * @brief Searches for an item with the specified key in the table.
+ *
+ * @details Walks the synonym list of the bucket selected by the key's hash. Every item
+ *          caches the full hash of its key, so the keys are compared by value only
+ *          when the hashes are equal. In interned mode, the key is first looked up in
+ *          the pool; a key that was never interned is not in the table. During an
+ *          incremental rehash, both bucket arrays are searched. The table is not modified.
+ *
+ * @param table A pointer to the table.
+ * @param key The key of the item to search for.
+ *
+ * @pre 'table' must be initialized. 'key' must be a null-terminated string.
+ *
+ * @code
+ * ht_item_t *item = ht_dyn_search(&my_table, "my_key");
+ * @endcode
+ *
+ * @retval NULL The key was not found or 'table' is NULL.
+ * @return A pointer to the found item.
+ */
+ht_item_t *ht_dyn_search(ht_dyn_table_t *table, char *key) {
+
+    // Check for NULL
+    if (table == NULL || table->items == NULL) {
+        return NULL;
+    }
+
+    key = ht_dyn_table_key(table, key, false);
+    if (key == NULL) {
+        return NULL;
+    }
+    return ht_dyn_find(table, key, ht_dyn_hash_key(table, key));
+}
+
+/**
+ * @brief Searches for an item by the canonical pointer of its key.
+ *
+ * @details The fast path of interned mode: 'key' is hashed by its address and compared
+ *          with `==`, so the key bytes are never read. In other modes, this is
+ *          `ht_dyn_search`. The table is not modified.
+ *
+ * @param table A pointer to the table.
+ * @param key A canonical key returned by the table's pool.
+ *
+ * @pre 'table' must be initialized. In interned mode, 'key' must come from `ht_intern`
+ *      or `ht_intern_find` of the table's pool; other pointers are never found.
+ *
+ * @code
+ * char *key = ht_intern(ht_intern_default(), "my_key");
+ * for (int i = 0; i < n; i++) {
+ *     ht_item_t *item = ht_dyn_search_interned(&my_table, key);
+ * }
+ * @endcode
+ *
+ * @retval NULL The key was not found or 'table' is NULL.
+ * @return A pointer to the found item.
+ */
+ht_item_t *ht_dyn_search_interned(ht_dyn_table_t *table, char *key) {
+
+    // Check for NULL
+    if (table == NULL || table->items == NULL || key == NULL) {
+        return NULL;
+    }
+
+    return ht_dyn_find(table, key, ht_dyn_hash_key(table, key));
+}
+
+/**
+ * @brief Searches for an item by its key and the precomputed hash of the key.
+ *
+ * @details Like `ht_dyn_search`, but 'key' is not hashed again. In interned mode, where
+ *          keys are hashed by the address of their canonical copy, 'hash' is ignored and
+ *          this is `ht_dyn_search`. The table is not modified.
+ *
+ * @param table A pointer to the table.
+ * @param key The key of the item to search for.
+ * @param hash The hash of 'key' computed with the table's hash function and seed.
+ *
+ * @pre 'table' must be initialized. 'key' must be a null-terminated string.
+ *
+ * @code
+ * uint64_t hash = my_table.hash(key, strlen(key), my_table.seed);
+ * ht_item_t *item = ht_dyn_search_hashed(&my_table, key, hash);
+ * @endcode
+ *
+ * @retval NULL The key was not found or 'table' is NULL.
+ * @return A pointer to the found item.
+ */
+ht_item_t *ht_dyn_search_hashed(ht_dyn_table_t *table, char *key, uint64_t hash) {
+
+    // Check for NULL
+    if (table == NULL || table->items == NULL || key == NULL) {
+        return NULL;
+    }
+
+    if (table->intern != NULL) {
+        return ht_dyn_search(table, key);
+    }
+    return ht_dyn_find(table, key, hash);
+}
+
+/**
+ * @brief Rehashes all items of the table into a new bucket array.
+ *
+ * @details Allocates a bucket array with the smallest prime number of buckets that is
+ *          at least 'size' and relinks every item into it using the full hash stored in
+ *          the item, so no key is hashed again. An incremental rehash in progress is
+ *          completed first. Items themselves are not reallocated,
+ *          so pointers returned by `ht_dyn_search` and `ht_dyn_get` stay valid.
+ *
+ * @param table A pointer to the table.
+ * @param size The requested number of buckets.
+ *
+ * @pre 'table' must be initialized.
+ *
+ * @post On success, the table has the new number of buckets and contains the same items.
+ *       On failure, the table is left unchanged.
+ *
+ * @note The cost is O(size + count); `ht_dyn_insert` calls it with a doubled size, so
+ *       the cost per insertion stays amortized O(1).
+ *
+ * @code
+ * ht_dyn_resize(&my_table, 100000); // presize before a bulk load
+ * @endcode
+ *
+ * @retval true The table was rehashed.
+ * @retval false 'table' is NULL or the new bucket array could not be allocated.
+ */
+bool ht_dyn_resize(ht_dyn_table_t *table, int size) {
+
+    // Check for NULL
+    if (table == NULL || table->items == NULL) {
+        return false;
+    }
+
+    ht_dyn_finish_migration(table);
+
+    size = ht_dyn_next_prime(size);
+    ht_item_t **newItems = calloc(size, sizeof(ht_item_t *));
+    if (newItems == NULL) {
+        return false;
+    }
+
+    // Relink each item to the front of its new synonym list
+    for (int i = 0; i < table->size; i++) {
+        ht_item_t *current = table->items[i];
+        while (current != NULL) {
+            ht_item_t *nextItem = current->next;
+            int index = (int) (current->hash % (uint64_t) size);
+            current->next = newItems[index];
+            newItems[index] = current;
+            current = nextItem;
+        }
+    }
+
+    free(table->items);
+    table->items = newItems;
+    table->size = size;
+    return true;
+}
+
+/**
+ * @brief Recomputes the full hash stored in every item with the current hash function.
+ *
+ * @details The items stay in their buckets; the caller relinks them afterwards.
+ *
+ * @param table A pointer to an initialized table.
+ *
+ * @return This function does not return a value.
+ */
+static void ht_dyn_rehash_items(ht_dyn_table_t *table) {
+    for (int i = 0; i < table->size; i++) {
+        for (ht_item_t *current = table->items[i]; current != NULL; current = current->next) {
+            current->hash = ht_dyn_hash_key(table, current->key);
+        }
+    }
+}
+
+/**
+ * @brief Selects the hash function and seed of the table.
+ *
+ * @details Stores the new function and seed, recomputes the full hashes stored in the
+ *          items and relinks them, so it may be called at any time. Calling it right after `ht_dyn_init`
+ *          avoids the rehash.
+ *
+ * @param table A pointer to the table.
+ * @param hash The hash function, see ht_hash.h.
+ * @param seed The seed passed to the hash function, NULL for an all-zero seed.
+ *
+ * @pre 'table' must be initialized.
+ *
+ * @post All items are placed according to the new hash function.
+ *
+ * @code
+ * uint64_t seed[2] = {random_u64(), random_u64()};
+ * ht_dyn_set_hash(&my_table, ht_hash_siphash, seed); // keys come from the network
+ * @endcode
+ *
+ * @warning If rehashing a non-empty table fails, the previous function is restored.
+ *
+ * @retval true The function was selected.
+ * @retval false 'table' or 'hash' is NULL, or the rehash failed.
+ */
+bool ht_dyn_set_hash(ht_dyn_table_t *table, ht_hash_fn_t hash, const uint64_t seed[2]) {
+
+    // Check for NULL
+    if (table == NULL || table->items == NULL || hash == NULL) {
+        return false;
+    }
+
+    // Gather all items in one bucket array before their hashes are recomputed
+    ht_dyn_finish_migration(table);
+
+    ht_hash_fn_t oldHash = table->hash;
+    uint64_t oldSeed[2] = {table->seed[0], table->seed[1]};
+    table->hash = hash;
+    table->seed[0] = seed != NULL ? seed[0] : 0;
+    table->seed[1] = seed != NULL ? seed[1] : 0;
+
+    // Items of an empty table need no relinking
+    if (table->count == 0) {
+        return true;
+    }
+
+    // The stored hashes were computed by the previous function
+    ht_dyn_rehash_items(table);
+    if (ht_dyn_resize(table, table->size)) {
+        return true;
+    }
+    table->hash = oldHash;
+    table->seed[0] = oldSeed[0];
+    table->seed[1] = oldSeed[1];
+    ht_dyn_rehash_items(table);
+    return false;
+}
+
+/**
+ * @brief Inserts or updates an item whose key is already hashed.
+ *
+ * @details Shared by `ht_dyn_insert`, `ht_dyn_insert_hashed` and `ht_dyn_insert_batch`,
+ *          see `ht_dyn_insert`.
+ *
+ * @param table A pointer to an initialized table.
+ * @param key The key associated with the item, a canonical key in interned mode.
+ * @param hash The full hash of 'key'.
+ * @param value The value to be inserted or updated.
+ * @param grow Whether the table may grow before a new item is added.
+ *
+ * @retval NULL The item could not be allocated.
+ * @return A pointer to the updated or added item.
+ */
+static ht_item_t *ht_dyn_insert_item(ht_dyn_table_t *table, char *key, uint64_t hash,
+                                     float value, bool grow) {
+    ht_dyn_migrate_step(table);
+
+    // Update the item if it is already in the table
+    ht_item_t *element = ht_dyn_find(table, key, hash);
+    if (element != NULL) {
+        element->value = value;
+        return element;
+    }
+
+    // Grow the table before the load factor limit is exceeded
+    if (grow && table->max_load > 0 && table->count + 1 > table->max_load * table->size) {
+        if (table->migrate_step > 0) {
+            ht_dyn_start_migration(table, 2 * table->size);
+        }
+        else {
+            ht_dyn_resize(table, 2 * table->size);
+        }
+    }
+
+    ht_item_t *newElement = ht_dyn_new_item(table, key);
+    if (newElement == NULL) {
+        return NULL;
+    }
+    newElement->value = value;
+    newElement->hash = hash;
+
+    // Insert the item as the first in the cell
+    int index = (int) (hash % (uint64_t) table->size);
+    newElement->next = table->items[index];
+    table->items[index] = newElement;
+    table->count++;
+    return newElement;
+}
+
+/**
+ * @brief Inserts or updates an item in the table.
+ *
+ * @details If an item with the key exists, its value is updated. Otherwise a new item,
+ *          carrying the full hash of its key, is added to the beginning of its synonym list. Before adding, the table is
+ *          grown to the next prime at least twice its size when the new item would
+ *          exceed the load factor limit; with a positive `migrate_step`, the growth only
+ *          starts an incremental rehash.
+ *
+ * @param table A pointer to the table.
+ * @param key The key associated with the item.
+ * @param value The value to be inserted or updated.
+ *
+ * @pre 'table' must be initialized. 'key' must be a null-terminated string.
+ *
+ * @code
+ * ht_dyn_insert(&my_table, "key1", 1.0f);
+ * @endcode
+ *
+ * @note In interned mode, a new key is added to the pool.
+ *
+ * @warning If growing the table fails, the item is still inserted into the current
+ *          bucket array. If allocating the item fails, the insertion is not completed.
+ *
+ * @return This function does not return a value.
+ */
+void ht_dyn_insert(ht_dyn_table_t *table, char *key, float value) {
+
+    // Check for NULL
+    if (table == NULL || table->items == NULL) {
+        return;
+    }
+
+    // In interned mode, the key is replaced by its canonical copy
+    key = ht_dyn_table_key(table, key, true);
+    if (key == NULL) {
+        return;
+    }
+
+    ht_dyn_insert_item(table, key, ht_dyn_hash_key(table, key), value, true);
+}
+
+/**
+ * @brief Inserts or updates an item, given the precomputed hash of its key.
+ *
+ * @details Like `ht_dyn_insert`, but 'key' is not hashed again, and the stored item is
+ *          returned, so a caller that needs it does not have to search for it again. In
+ *          interned mode, 'hash' is ignored and the key is hashed as in `ht_dyn_insert`.
+ *
+ * @param table A pointer to the table.
+ * @param key The key associated with the item.
+ * @param hash The hash of 'key' computed with the table's hash function and seed.
+ * @param value The value to be inserted or updated.
+ *
+ * @pre 'table' must be initialized. 'key' must be a null-terminated string.
+ *
+ * @code
+ * ht_item_t *item = ht_dyn_insert_hashed(&my_table, key, hash, 1.0f);
+ * @endcode
+ *
+ * @warning A wrong 'hash' puts the item into a bucket where no other function finds it.
+ *
+ * @retval NULL 'table' or 'key' is NULL, or memory allocation failed.
+ * @return A pointer to the updated or added item.
+ */
+ht_item_t *ht_dyn_insert_hashed(ht_dyn_table_t *table, char *key, uint64_t hash, float value) {
+
+    // Check for NULL
+    if (table == NULL || table->items == NULL || key == NULL) {
+        return NULL;
+    }
+
+    if (table->intern != NULL) {
+        key = ht_dyn_table_key(table, key, true);
+        if (key == NULL) {
+            return NULL;
+        }
+        hash = ht_dyn_hash_key(table, key);
+    }
+    return ht_dyn_insert_item(table, key, hash, value, true);
+}
+
+/**
+ * @brief Retrieves the value associated with a key from the table.
+ *
+ * @param table A pointer to the table.
+ * @param key The key string associated with the desired value.
+ *
+ * @pre 'table' must be initialized. 'key' must be a null-terminated string.
+ *
+ * @code
+ * float *value = ht_dyn_get(&my_table, "my_key");
+ * @endcode
+ *
+ * @retval NULL The key was not found or 'table' is NULL.
+ * @retval non-NULL A pointer to the value associated with the key.
+ */
+float *ht_dyn_get(ht_dyn_table_t *table, char *key) {
+    ht_item_t *element = ht_dyn_search(table, key);
+    return element != NULL ? &(element->value) : NULL;
+}
+
+/**
+ * @brief Inserts or updates many items, overlapping their cache misses.
+ *
+ * @details Equivalent to calling `ht_dyn_insert` for every key in order, but faster on
+ *          tables larger than the cache. For each group of HT_DYN_BATCH_GROUP keys, all
+ *          keys are hashed and their buckets prefetched, the bucket heads are loaded and
+ *          prefetched, and only then are the items inserted, so the memory accesses of a
+ *          group are in flight at the same time. The table grows between groups, when the
+ *          items actually added exceed the load factor limit, so a batch that mostly
+ *          updates existing keys does not grow it.
+ *
+ * @param table A pointer to the table.
+ * @param keys The keys of the items.
+ * @param values The values of the items, 'values[i]' belongs to 'keys[i]'.
+ * @param count The number of items.
+ *
+ * @pre 'table' must be initialized. 'keys' and 'values' must hold 'count' elements and
+ *      every key must be a null-terminated string.
+ *
+ * @post Every key is in the table; a key repeated in the batch holds its last value.
+ *
+ * @code
+ * char *keys[] = {"Bitcoin", "Ethereum", "Solana"};
+ * float values[] = {53247.71f, 3208.67f, 134.50f};
+ * ht_dyn_insert_batch(&my_table, keys, values, 3);
+ * @endcode
+ *
+ * @note Within a group, the load factor may exceed the limit by up to
+ *       HT_DYN_BATCH_GROUP items. The growth after a group rehashes at once, also with a
+ *       positive `migrate_step`; batches favour throughput over the latency of a call.
+ *
+ * @warning As with `ht_dyn_insert`, items whose allocation fails are skipped.
+ *
+ * @return This function does not return a value.
+ */
+void ht_dyn_insert_batch(ht_dyn_table_t *table, char *keys[], const float values[], int count) {
+
+    // Check for NULL
+    if (table == NULL || table->items == NULL || keys == NULL || values == NULL) {
+        return;
+    }
+
+    char *groupKeys[HT_DYN_BATCH_GROUP];
+    uint64_t hashes[HT_DYN_BATCH_GROUP];
+    for (int start = 0; start < count; start += HT_DYN_BATCH_GROUP) {
+        int groupSize = count - start < HT_DYN_BATCH_GROUP ? count - start : HT_DYN_BATCH_GROUP;
+
+        // Hash the keys and prefetch their buckets
+        for (int i = 0; i < groupSize; i++) {
+            groupKeys[i] = ht_dyn_table_key(table, keys[start + i], true);
+            if (groupKeys[i] != NULL) {
+                hashes[i] = ht_dyn_hash_key(table, groupKeys[i]);
+                HT_DYN_PREFETCH(&table->items[hashes[i] % (uint64_t) table->size]);
+            }
+        }
+        // Prefetch the first items of the synonym lists
+        for (int i = 0; i < groupSize; i++) {
+            if (groupKeys[i] != NULL) {
+                ht_item_t *head = table->items[hashes[i] % (uint64_t) table->size];
+                if (head != NULL) {
+                    HT_DYN_PREFETCH(head);
+                }
+            }
+        }
+        // Insert, the buckets and heads are in the cache by now
+        for (int i = 0; i < groupSize; i++) {
+            if (groupKeys[i] != NULL) {
+                ht_dyn_insert_item(table, groupKeys[i], hashes[i], values[start + i], false);
+            }
+        }
+        // Grow only once the group is done. With a positive migrate_step, every insert
+        // still runs a migration step, so items may move between buckets within the group;
+        // the insert finds them by their hash, only the prefetch of those buckets is lost
+        if (table->max_load > 0 && table->count > table->max_load * table->size) {
+            int needed = (int) (table->count / table->max_load) + 1;
+            ht_dyn_resize(table, needed > 2 * table->size ? needed : 2 * table->size);
+        }
+    }
+}
+
+/**
+ * @brief Retrieves the values of many keys, overlapping their cache misses.
+ *
+ * @details Equivalent to calling `ht_dyn_get` for every key, but faster on tables larger
+ *          than the cache. For each group of HT_DYN_BATCH_GROUP keys, all keys are hashed
+ *          and their buckets prefetched, the bucket heads are loaded and prefetched, and
+ *          only then are the synonym lists walked. The table is not modified.
+ *
+ * @param table A pointer to the table.
+ * @param keys The keys to look up.
+ * @param values Receives a pointer to the value of 'keys[i]' in 'values[i]', or NULL
+ *        when the key is not in the table.
+ * @param count The number of keys.
+ *
+ * @pre 'table' must be initialized. 'keys' and 'values' must hold 'count' elements and
+ *      every key must be a null-terminated string.
+ *
+ * @code
+ * char *keys[] = {"Bitcoin", "Monero"};
+ * float *values[2];
+ * int found = ht_dyn_get_batch(&my_table, keys, values, 2); // values[1] == NULL
+ * @endcode
+ *
+ * @return The number of keys found in the table.
+ */
+int ht_dyn_get_batch(ht_dyn_table_t *table, char *keys[], float *values[], int count) {
+
+    // Check for NULL
+    if (table == NULL || table->items == NULL || keys == NULL || values == NULL) {
+        return 0;
+    }
+
+    char *groupKeys[HT_DYN_BATCH_GROUP];
+    uint64_t hashes[HT_DYN_BATCH_GROUP];
+    ht_item_t *heads[HT_DYN_BATCH_GROUP];
+    int found = 0;
+    for (int start = 0; start < count; start += HT_DYN_BATCH_GROUP) {
+        int groupSize = count - start < HT_DYN_BATCH_GROUP ? count - start : HT_DYN_BATCH_GROUP;
+
+        // Hash the keys and prefetch their buckets
+        for (int i = 0; i < groupSize; i++) {
+            groupKeys[i] = ht_dyn_table_key(table, keys[start + i], false);
+            if (groupKeys[i] != NULL) {
+                hashes[i] = ht_dyn_hash_key(table, groupKeys[i]);
+                HT_DYN_PREFETCH(&table->items[hashes[i] % (uint64_t) table->size]);
+            }
+        }
+        // Load the first items of the synonym lists and prefetch them
+        for (int i = 0; i < groupSize; i++) {
+            heads[i] = NULL;
+            if (groupKeys[i] != NULL) {
+                heads[i] = table->items[hashes[i] % (uint64_t) table->size];
+                if (heads[i] != NULL) {
+                    HT_DYN_PREFETCH(heads[i]);
+                }
+            }
+        }
+        // Walk the synonym lists
+        for (int i = 0; i < groupSize; i++) {
+            ht_item_t *element = NULL;
+            if (heads[i] != NULL) {
+                element = ht_dyn_walk(table, heads[i], groupKeys[i], hashes[i]);
+            }
+            // Buckets not migrated yet still hold items
+            if (element == NULL && groupKeys[i] != NULL && table->old_items != NULL) {
+                element = ht_dyn_walk(table, table->old_items[hashes[i] % (uint64_t) table->old_size],
+                                      groupKeys[i], hashes[i]);
+            }
+            values[start + i] = element != NULL ? &(element->value) : NULL;
+            if (element != NULL) {
+                found++;
+            }
+        }
+    }
+    return found;
+}
+
+/**
+ * @brief Unlinks and releases the item with the given key from a synonym list.
+ *
+ * @param table A pointer to an initialized table.
+ * @param link The bucket holding the synonym list.
+ * @param key The key of the item to delete.
+ * @param hash The full hash of 'key'.
+ *
+ * @retval true The item was found and released.
+ * @retval false The key is not in the list.
+ */
+static bool ht_dyn_unlink(ht_dyn_table_t *table, ht_item_t **link, const char *key, uint64_t hash) {
+    // Walk the cell keeping a pointer to the link that references the current item
+    while (*link != NULL) {
+        ht_item_t *cellElement = *link;
+        if (cellElement->hash == hash && ht_dyn_key_equals(table, cellElement->key, key)) {
+            *link = cellElement->next;
+            ht_dyn_release_item(table, cellElement);
+            table->count--;
+            return true;
+        }
+        link = &cellElement->next;
+    }
+    return false;
+}
+
+/**
+ * @brief Removes the item with the given key and hash from both bucket arrays.
+ *
+ * @details Shared by `ht_dyn_delete` and `ht_dyn_delete_hashed`, see `ht_dyn_delete`.
+ *
+ * @param table A pointer to an initialized table.
+ * @param key The key of the item to delete, a canonical key in interned mode.
+ * @param hash The full hash of 'key'.
+ *
+ * @return This function does not return a value.
+ */
+static void ht_dyn_remove(ht_dyn_table_t *table, const char *key, uint64_t hash) {
+    ht_dyn_migrate_step(table);
+    if (!ht_dyn_unlink(table, &table->items[hash % (uint64_t) table->size], key, hash)
+        && table->old_items != NULL) {
+        // Buckets not migrated yet still hold items
+        ht_dyn_unlink(table, &table->old_items[hash % (uint64_t) table->old_size], key, hash);
+    }
+}
+
+/**
+ * @brief Removes an item with the specified key from the table.
+ *
+ * @details Unlinks the item from its synonym list and frees the item and its key
+ *          (in arena mode, the item is kept for reuse instead). The table never shrinks.
+ *          During an incremental rehash, the deletion also migrates `migrate_step` buckets.
+ *
+ * @param table A pointer to the table.
+ * @param key The key of the item to delete.
+ *
+ * @pre 'table' must be initialized. 'key' must be a null-terminated string.
+ *
+ * @post The item is no longer in the table and its memory is freed.
+ *
+ * @code
+ * ht_dyn_delete(&my_table, "my_key");
+ * @endcode
+ *
+ * @return This function does not return a value.
+ */
+void ht_dyn_delete(ht_dyn_table_t *table, char *key) {
+
+    // Check for NULL
+    if (table == NULL || table->items == NULL) {
+        return;
+    }
+
+    // A key that was never interned is not in an interned table
+    key = ht_dyn_table_key(table, key, false);
+    if (key == NULL) {
+        return;
+    }
+
+    ht_dyn_remove(table, key, ht_dyn_hash_key(table, key));
+}
+
+/**
+ * @brief Removes an item, given the precomputed hash of its key.
+ *
+ * @details Like `ht_dyn_delete`, but 'key' is not hashed again. In interned mode, 'hash'
+ *          is ignored and this is `ht_dyn_delete`.
+ *
+ * @param table A pointer to the table.
+ * @param key The key of the item to delete.
+ * @param hash The hash of 'key' computed with the table's hash function and seed.
+ *
+ * @pre 'table' must be initialized. 'key' must be a null-terminated string.
+ *
+ * @return This function does not return a value.
+ */
+void ht_dyn_delete_hashed(ht_dyn_table_t *table, char *key, uint64_t hash) {
+
+    // Check for NULL
+    if (table == NULL || table->items == NULL || key == NULL) {
+        return;
+    }
+
+    if (table->intern != NULL) {
+        ht_dyn_delete(table, key);
+        return;
+    }
+    ht_dyn_remove(table, key, hash);
+}
+
+/**
+ * @brief Deletes all items from the table.
+ *
+ * @details Frees every item and its key and resets all buckets to NULL. In arena mode,
+ *          the slabs are rewound instead, without visiting the items. The bucket array
+ *          keeps its current size, so the table can be refilled without regrowing.
+ *
+ * @param table A pointer to the table.
+ *
+ * @pre 'table' must be initialized.
+ *
+ * @post The table is empty.
+ *
+ * @code
+ * ht_dyn_delete_all(&my_table);
+ * @endcode
+ *
+ * @return This function does not return a value.
+ */
+void ht_dyn_delete_all(ht_dyn_table_t *table) {
+
+    // Check for NULL
+    if (table == NULL || table->items == NULL) {
+        return;
+    }
+
+    // Slabs are rewound at once instead of freeing the items one by one
+    if (table->use_arena) {
+        free(table->old_items);
+        table->old_items = NULL;
+        table->old_size = 0;
+        table->migrate_index = 0;
+        ht_arena_reset(&table->item_arena);
+        ht_arena_reset(&table->key_arena);
+        table->free_items = NULL;
+        memset(table->items, 0, table->size * sizeof(ht_item_t *));
+        table->count = 0;
+        return;
+    }
+
+    ht_dyn_finish_migration(table);
+    for (int i = 0; i < table->size; i++) {
+        ht_item_t *current = table->items[i];
+        while (current != NULL) {
+            ht_item_t *nextItem = current->next;
+            if (table->intern == NULL) {
+                ht_item_free_key(current);
+            }
+            free(current);
+            current = nextItem;
+        }
+        table->items[i] = NULL;
+    }
+    table->count = 0;
+}
+
+/**
+ * @brief Deletes all items and releases the bucket array of the table.
+ *
+ * @param table A pointer to the table.
+ *
+ * @post The table holds no memory and must be initialized again before further use.
+ *
+ * @code
+ * ht_dyn_free(&my_table);
+ * @endcode
+ *
+ * @return This function does not return a value.
+ */
+void ht_dyn_free(ht_dyn_table_t *table) {
+
+    // Check for NULL
+    if (table == NULL) {
+        return;
+    }
+
+    ht_dyn_delete_all(table);
+    ht_arena_free(&table->item_arena);
+    ht_arena_free(&table->key_arena);
+    free(table->items);
+    table->items = NULL;
+    table->size = 0;
+}
+
+/**
+ * @brief Returns the current load factor (items per bucket) of the table.
+ *
+ * @param table A pointer to the table.
+ *
+ * @return The load factor, or 0 for a NULL or released table.
+ */
+float ht_dyn_load_factor(ht_dyn_table_t *table) {
+    if (table == NULL || table->size == 0) {
+        return 0;
+    }
+    return (float) table->count / table->size;
+}
+
+/* End of hashtable_dyn.c */
@@ -0,0 +1,88 @@
+/*
+ * Header file for the growable hash table with explicitly linked synonyms.
+ * The table shares the item type with hashtable.h, but the bucket array
+ * lives on the heap and is rehashed into a larger prime size once the load
+ * factor exceeds the configured limit.
+ */
+
+#ifndef IAL_HASHTABLE_DYN_H
+#define IAL_HASHTABLE_DYN_H
+
+#include "hashtable.h"
+#include "ht_arena.h"
+#include "ht_hash.h"
+#include <stdbool.h>
+
+// Bucket count used when ht_dyn_init is given a non-positive size
+#define HT_DYN_DEFAULT_SIZE 13
+
+// Load factor (items per bucket) that triggers growth
+#define HT_DYN_MAX_LOAD 0.75f
+
+// Suggested value of 'migrate_step', enough to finish a migration before the next one
+#define HT_DYN_MIGRATE_STEP 4
+
+// Empty buckets an operation may skip per bucket it has to migrate
+#define HT_DYN_MIGRATE_EMPTY_VISITS 10
+
+// Number of keys the batch functions hash and prefetch before resolving them
+#define HT_DYN_BATCH_GROUP 32
+
+// Hash function used when no other is selected
+#define HT_DYN_DEFAULT_HASH ht_hash_fnv1a
+
+// Interning pool, see ht_intern.h
+struct ht_intern_pool;
+
+// Growable table
+typedef struct ht_dyn_table {
+  ht_item_t **items; // bucket array of 'size' synonym lists
+  int size;          // number of buckets, always a prime number
+  int count;         // number of stored items
+  float max_load;    // load factor limit, growth is disabled when <= 0
+  ht_hash_fn_t hash; // hash function of the keys
+  uint64_t seed[2];  // seed passed to the hash function
+  bool use_arena;         // items and keys come from the arenas below
+  ht_arena_t item_arena;  // slabs holding the items (arena mode)
+  ht_arena_t key_arena;   // slabs holding the key bytes (arena mode)
+  ht_item_t *free_items;  // deleted items kept for reuse (arena mode)
+  struct ht_intern_pool *intern; // pool of the keys (interned mode), else NULL
+  int migrate_step;       // buckets migrated per operation, 0 rehashes at once
+  ht_item_t **old_items;  // bucket array being migrated, NULL when none is
+  int old_size;           // number of buckets of 'old_items'
+  int migrate_index;      // next bucket of 'old_items' to migrate
+} ht_dyn_table_t;
+
+int ht_dyn_next_prime(int n);
+bool ht_dyn_init(ht_dyn_table_t *table, int size);
+bool ht_dyn_init_arena(ht_dyn_table_t *table, int size);
+bool ht_dyn_init_interned(ht_dyn_table_t *table, int size,
+                          struct ht_intern_pool *pool);
+// Lookups (search, search_interned, search_hashed, get, get_batch) only read
+// the table, also during an incremental rehash, which only insertions and
+// deletions advance. They may run concurrently with each other but not with
+// any other function. The _hashed functions take the hash of the key computed
+// with the table's hash function and seed.
+ht_item_t *ht_dyn_search(ht_dyn_table_t *table, char *key);
+ht_item_t *ht_dyn_search_interned(ht_dyn_table_t *table, char *key);
+ht_item_t *ht_dyn_search_hashed(ht_dyn_table_t *table, char *key, uint64_t hash);
+void ht_dyn_insert(ht_dyn_table_t *table, char *key, float value);
+ht_item_t *ht_dyn_insert_hashed(ht_dyn_table_t *table, char *key,
+                                uint64_t hash, float value);
+float *ht_dyn_get(ht_dyn_table_t *table, char *key);
+void ht_dyn_insert_batch(ht_dyn_table_t *table, char *keys[],
+                         const float values[], int count);
+int ht_dyn_get_batch(ht_dyn_table_t *table, char *keys[], float *values[],
+                     int count);
+void ht_dyn_delete(ht_dyn_table_t *table, char *key);
+void ht_dyn_delete_hashed(ht_dyn_table_t *table, char *key, uint64_t hash);
+void ht_dyn_delete_all(ht_dyn_table_t *table);
+void ht_dyn_free(ht_dyn_table_t *table);
+bool ht_dyn_resize(ht_dyn_table_t *table, int size);
+bool ht_dyn_set_hash(ht_dyn_table_t *table, ht_hash_fn_t hash,
+                     const uint64_t seed[2]);
+float ht_dyn_load_factor(ht_dyn_table_t *table);
+
+#endif
+
+/* End of hashtable_dyn.h */
@@ -0,0 +1,464 @@
+/**
+ * @file hashtable_oa.c
+ * @brief Open-addressing hashtable with Robin Hood probing.
+ * @details Implements a hashtable that stores its items directly in flat arrays of keys,
+ *          values and full hashes instead of linking them into synonym lists. A key is
+ *          placed at the first suitable slot found by linear probing from its home slot
+ *          (its hash reduced by the power-of-two size).
+ *
+ *          Robin Hood displacement keeps the probe sequences short even at high load:
+ *          when an inserted item has travelled further from its home slot than the item
+ *          occupying the current slot, the two swap places and the insertion continues
+ *          with the displaced item. As a consequence, the distances along any probe
+ *          sequence never drop by more than one, and a lookup can stop as soon as it
+ *          reaches a slot whose item is closer to its home than the searched key would be.
+ *
+ *          Deletion uses backward shifting instead of tombstones: the items following the
+ *          deleted slot are moved one slot back until an empty slot or an item sitting in
+ *          its home slot is reached, so the table never degrades after many deletions.
+ *
+ *          Key functions implemented:
+ *          - ht_oa_init: Allocates the slot arrays of the table.
+ *          - ht_oa_search: Finds the slot holding a key.
+ *          - ht_oa_insert: Inserts a new item or updates an existing one.
+ *          - ht_oa_get: Retrieves an item's value from the table.
+ *          - ht_oa_delete: Removes an item from the table.
+ *          - ht_oa_delete_all: Deletes all items from the table.
+ *          - ht_oa_free: Deletes all items and releases the slot arrays.
+ *          - ht_oa_resize: Rehashes the table into new slot arrays.
+ *
+ * @code
+ * ht_oa_table_t my_table;
+ * ht_oa_init(&my_table, 0);
+ * ht_oa_insert(&my_table, "key1", 1.0f);
+ * float *value = ht_oa_get(&my_table, "key1");
+ * if (value) {
+ *     printf("Found value: %f\n", *value);
+ * }
+ * ht_oa_free(&my_table);
+ * @endcode
+ *
+ * @see hashtable_oa.h for type definitions and constants.
+ * @see hashtable_dyn.c for the growable table with explicitly linked synonyms.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project02-2021 for the project repository.
+ */
+
+#include "hashtable_oa.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Defined in hashtable.c, string.h does not declare it in strict C11 mode
+char *strdup(const char *s);
+
+/**
+ * @brief Returns the distance of a slot from the home slot of the given hash.
+ *
+ * @param table A pointer to the table.
+ * @param hash The full hash stored for the slot.
+ * @param slot The index of the slot.
+ *
+ * @return The number of probes needed to get from the home slot to 'slot'.
+ */
+static inline int ht_oa_distance(ht_oa_table_t *table, uint64_t hash, int slot) {
+    return (slot - (int) (hash & (uint64_t) (table->size - 1))) & (table->size - 1);
+}
+
+/**
+ * @brief Allocates the three slot arrays for 'size' slots.
+ *
+ * @retval true The arrays were allocated and all slots are empty.
+ * @retval false Allocation failed; 'table' is left unchanged.
+ */
+static bool ht_oa_alloc(ht_oa_table_t *table, int size) {
+    char **keys = calloc(size, sizeof(char *));
+    float *values = malloc(size * sizeof(float));
+    uint64_t *hashes = malloc(size * sizeof(uint64_t));
+    if (keys == NULL || values == NULL || hashes == NULL) {
+        free(keys);
+        free(values);
+        free(hashes);
+        return false;
+    }
+    table->keys = keys;
+    table->values = values;
+    table->hashes = hashes;
+    table->size = size;
+    return true;
+}
+
+/**
+ * @brief Places an item known not to be in the table, using Robin Hood displacement.
+ *
+ * @details Probes linearly from the home slot. Whenever the carried item is further
+ *          from its home than the resident item, the two are swapped and the probing
+ *          continues with the evicted item.
+ *
+ * @param table A pointer to the table, which must have at least one empty slot.
+ * @param key The key, whose ownership passes to the table.
+ * @param value The value of the item.
+ * @param hash The full hash of the key.
+ *
+ * @return This function does not return a value.
+ */
+static void ht_oa_place(ht_oa_table_t *table, char *key, float value, uint64_t hash) {
+    int mask = table->size - 1;
+    int slot = (int) (hash & (uint64_t) mask);
+    int distance = 0;
+
+    while (table->keys[slot] != NULL) {
+        int residentDistance = ht_oa_distance(table, table->hashes[slot], slot);
+        // Take the slot from an item that is closer to its home
+        if (residentDistance < distance) {
+            char *tmpKey = table->keys[slot];
+            float tmpValue = table->values[slot];
+            uint64_t tmpHash = table->hashes[slot];
+            table->keys[slot] = key;
+            table->values[slot] = value;
+            table->hashes[slot] = hash;
+            key = tmpKey;
+            value = tmpValue;
+            hash = tmpHash;
+            distance = residentDistance;
+        }
+        slot = (slot + 1) & mask;
+        distance++;
+    }
+
+    table->keys[slot] = key;
+    table->values[slot] = value;
+    table->hashes[slot] = hash;
+}
+
+/**
+ * @brief Initializes an open-addressing hashtable.
+ *
+ * @details Allocates the slot arrays with the smallest power of two that is at least
+ *          'size' (HT_OA_DEFAULT_SIZE when 'size' is not positive) and marks all slots
+ *          empty. Keys are hashed by HT_OA_DEFAULT_HASH with an all-zero seed; both may
+ *          be changed through the `hash` and `seed` members while the table is empty.
+ *
+ * @param table A pointer to the table to be initialized.
+ * @param size The requested initial number of slots.
+ *
+ * @pre 'table' must not reference an initialized table, otherwise its memory is leaked.
+ *
+ * @post On success, the table is empty and ready for use.
+ *
+ * @code
+ * ht_oa_table_t my_table;
+ * if (!ht_oa_init(&my_table, 1024)) {
+ *     // handle allocation failure
+ * }
+ * @endcode
+ *
+ * @warning The table must be released with `ht_oa_free` to avoid memory leaks.
+ *
+ * @retval true The table was initialized.
+ * @retval false 'table' is NULL or the slot arrays could not be allocated.
+ */
+bool ht_oa_init(ht_oa_table_t *table, int size) {
+
+    // Check for NULL
+    if (table == NULL) {
+        return false;
+    }
+
+    int slots = 2;
+    while (slots < (size > 0 ? size : HT_OA_DEFAULT_SIZE)) {
+        slots *= 2;
+    }
+    table->keys = NULL;
+    table->size = 0;
+    table->count = 0;
+    table->max_load = HT_OA_MAX_LOAD;
+    table->hash = HT_OA_DEFAULT_HASH;
+    table->seed[0] = 0;
+    table->seed[1] = 0;
+    return ht_oa_alloc(table, slots);
+}
+
+/**
+ * @brief Searches for the slot holding the specified key.
+ *
+ * @details Probes from the key's home slot, comparing the stored hashes first and the
+ *          keys only when the hashes match. The search ends at an empty slot or at a
+ *          slot whose item is closer to its home than the key would be at that point,
+ *          because Robin Hood insertion would have placed the key there.
+ *
+ * @param table A pointer to the table.
+ * @param key The key to search for.
+ *
+ * @pre 'table' must be initialized. 'key' must be a null-terminated string.
+ *
+ * @code
+ * int slot = ht_oa_search(&my_table, "my_key");
+ * if (slot >= 0) {
+ *     printf("%s -> %f\n", my_table.keys[slot], my_table.values[slot]);
+ * }
+ * @endcode
+ *
+ * @warning The returned index is only valid until the next insertion or deletion.
+ *
+ * @retval -1 The key was not found or 'table' is NULL.
+ * @return The index of the slot holding the key.
+ */
+int ht_oa_search(ht_oa_table_t *table, char *key) {
+
+    // Check for NULL
+    if (table == NULL || table->keys == NULL) {
+        return -1;
+    }
+
+    uint64_t hash = table->hash(key, strlen(key), table->seed);
+    int mask = table->size - 1;
+    int slot = (int) (hash & (uint64_t) mask);
+
+    for (int distance = 0; table->keys[slot] != NULL; distance++) {
+        if (table->hashes[slot] == hash && strcmp(table->keys[slot], key) == 0) {
+            return slot;
+        }
+        // The key would have displaced this item
+        if (ht_oa_distance(table, table->hashes[slot], slot) < distance) {
+            return -1;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return -1;
+}
+
+/**
+ * @brief Rehashes all items into new slot arrays.
+ *
+ * @details Allocates arrays with the smallest power of two of slots that is at least
+ *          'size' and larger than the number of items, and re-places every item using
+ *          its stored hash, so no key is hashed again.
+ *
+ * @param table A pointer to the table.
+ * @param size The requested number of slots.
+ *
+ * @pre 'table' must be initialized.
+ *
+ * @post On success, the table has the new number of slots and contains the same items.
+ *       On failure, the table is left unchanged.
+ *
+ * @code
+ * ht_oa_resize(&my_table, 1 << 20); // presize before a bulk load
+ * @endcode
+ *
+ * @retval true The table was rehashed.
+ * @retval false 'table' is NULL or the new arrays could not be allocated.
+ */
+bool ht_oa_resize(ht_oa_table_t *table, int size) {
+
+    // Check for NULL
+    if (table == NULL || table->keys == NULL) {
+        return false;
+    }
+
+    int slots = 2;
+    while (slots < size || slots <= table->count) {
+        slots *= 2;
+    }
+
+    ht_oa_table_t old = *table;
+    if (!ht_oa_alloc(table, slots)) {
+        return false;
+    }
+    for (int i = 0; i < old.size; i++) {
+        if (old.keys[i] != NULL) {
+            ht_oa_place(table, old.keys[i], old.values[i], old.hashes[i]);
+        }
+    }
+    free(old.keys);
+    free(old.values);
+    free(old.hashes);
+    return true;
+}
+
+/**
+ * @brief Inserts or updates an item in the table.
+ *
+ * @details If the key is already stored, its value is updated. Otherwise the table is
+ *          grown to twice its size when the new item would exceed the load factor limit,
+ *          and the item is placed with Robin Hood displacement.
+ *
+ * @param table A pointer to the table.
+ * @param key The key associated with the item.
+ * @param value The value to be inserted or updated.
+ *
+ * @pre 'table' must be initialized. 'key' must be a null-terminated string.
+ *
+ * @code
+ * ht_oa_insert(&my_table, "key1", 1.0f);
+ * @endcode
+ *
+ * @warning When growth is disabled (or fails), the insertion is not completed once only
+ *          one empty slot is left, which is needed to terminate the probe sequences.
+ *
+ * @return This function does not return a value.
+ */
+void ht_oa_insert(ht_oa_table_t *table, char *key, float value) {
+
+    // Check for NULL
+    if (table == NULL || table->keys == NULL) {
+        return;
+    }
+
+    // Update the item if it is already in the table
+    int slot = ht_oa_search(table, key);
+    if (slot >= 0) {
+        table->values[slot] = value;
+        return;
+    }
+
+    // Grow the table before the load factor limit is exceeded
+    if (table->max_load > 0 && table->count + 1 > table->max_load * table->size) {
+        ht_oa_resize(table, 2 * table->size);
+    }
+    // Always keep an empty slot
+    if (table->count + 1 >= table->size) {
+        return;
+    }
+
+    char *newKey = strdup(key);
+    if (newKey == NULL) {
+        return;
+    }
+    ht_oa_place(table, newKey, value, table->hash(key, strlen(key), table->seed));
+    table->count++;
+}
+
+/**
+ * @brief Retrieves the value associated with a key from the table.
+ *
+ * @param table A pointer to the table.
+ * @param key The key string associated with the desired value.
+ *
+ * @pre 'table' must be initialized. 'key' must be a null-terminated string.
+ *
+ * @code
+ * float *value = ht_oa_get(&my_table, "my_key");
+ * @endcode
+ *
+ * @warning The returned pointer is only valid until the next insertion or deletion,
+ *          which may move items between slots.
+ *
+ * @retval NULL The key was not found or 'table' is NULL.
+ * @retval non-NULL A pointer to the value associated with the key.
+ */
+float *ht_oa_get(ht_oa_table_t *table, char *key) {
+    int slot = ht_oa_search(table, key);
+    return slot >= 0 ? &table->values[slot] : NULL;
+}
+
+/**
+ * @brief Removes an item with the specified key from the table.
+ *
+ * @details Frees the key and shifts the following items of the cluster one slot back,
+ *          until an empty slot or an item that already sits in its home slot is reached.
+ *          No tombstones are left behind.
+ *
+ * @param table A pointer to the table.
+ * @param key The key of the item to delete.
+ *
+ * @pre 'table' must be initialized. 'key' must be a null-terminated string.
+ *
+ * @post The item is no longer in the table and its key is freed.
+ *
+ * @code
+ * ht_oa_delete(&my_table, "my_key");
+ * @endcode
+ *
+ * @return This function does not return a value.
+ */
+void ht_oa_delete(ht_oa_table_t *table, char *key) {
+    int slot = ht_oa_search(table, key);
+    if (slot < 0) {
+        return;
+    }
+
+    int mask = table->size - 1;
+    free(table->keys[slot]);
+
+    // Backward shift of the items displaced past the deleted slot
+    int next = (slot + 1) & mask;
+    while (table->keys[next] != NULL && ht_oa_distance(table, table->hashes[next], next) > 0) {
+        table->keys[slot] = table->keys[next];
+        table->values[slot] = table->values[next];
+        table->hashes[slot] = table->hashes[next];
+        slot = next;
+        next = (next + 1) & mask;
+    }
+    table->keys[slot] = NULL;
+    table->count--;
+}
+
+/**
+ * @brief Deletes all items from the table.
+ *
+ * @details Frees every key and marks all slots empty. The slot arrays keep their size.
+ *
+ * @param table A pointer to the table.
+ *
+ * @pre 'table' must be initialized.
+ *
+ * @post The table is empty.
+ *
+ * @return This function does not return a value.
+ */
+void ht_oa_delete_all(ht_oa_table_t *table) {
+
+    // Check for NULL
+    if (table == NULL || table->keys == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < table->size; i++) {
+        free(table->keys[i]);
+        table->keys[i] = NULL;
+    }
+    table->count = 0;
+}
+
+/**
+ * @brief Deletes all items and releases the slot arrays of the table.
+ *
+ * @param table A pointer to the table.
+ *
+ * @post The table holds no memory and must be initialized again before further use.
+ *
+ * @return This function does not return a value.
+ */
+void ht_oa_free(ht_oa_table_t *table) {
+
+    // Check for NULL
+    if (table == NULL) {
+        return;
+    }
+
+    ht_oa_delete_all(table);
+    free(table->keys);
+    free(table->values);
+    free(table->hashes);
+    table->keys = NULL;
+    table->values = NULL;
+    table->hashes = NULL;
+    table->size = 0;
+}
+
+/**
+ * @brief Returns the current load factor (occupied slots per slot) of the table.
+ *
+ * @param table A pointer to the table.
+ *
+ * @return The load factor, or 0 for a NULL or released table.
+ */
+float ht_oa_load_factor(ht_oa_table_t *table) {
+    if (table == NULL || table->size == 0) {
+        return 0;
+    }
+    return (float) table->count / table->size;
+}
+
+/* End of hashtable_oa.c */
@@ -0,0 +1,47 @@
+/*
+ * Header file for the open-addressing hash table with Robin Hood probing.
+ * Keys, values and hashes are kept in three flat arrays indexed by slot,
+ * so no per-item allocation is needed besides the copy of the key.
+ */
+
+#ifndef IAL_HASHTABLE_OA_H
+#define IAL_HASHTABLE_OA_H
+
+#include "ht_hash.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Slot count used when ht_oa_init is given a non-positive size
+#define HT_OA_DEFAULT_SIZE 16
+
+// Load factor (occupied slots per slot) that triggers growth
+#define HT_OA_MAX_LOAD 0.9f
+
+// Hash function used when no other is selected
+#define HT_OA_DEFAULT_HASH ht_hash_xxh64
+
+// Open-addressing table
+typedef struct ht_oa_table {
+  char **keys;       // key of each slot, NULL for an empty slot
+  float *values;     // value of each slot
+  uint64_t *hashes;  // full hash of the key of each slot
+  int size;          // number of slots, always a power of two
+  int count;         // number of occupied slots
+  float max_load;    // load factor limit, growth is disabled when <= 0
+  ht_hash_fn_t hash; // hash function of the keys
+  uint64_t seed[2];  // seed passed to the hash function
+} ht_oa_table_t;
+
+bool ht_oa_init(ht_oa_table_t *table, int size);
+int ht_oa_search(ht_oa_table_t *table, char *key);
+void ht_oa_insert(ht_oa_table_t *table, char *key, float value);
+float *ht_oa_get(ht_oa_table_t *table, char *key);
+void ht_oa_delete(ht_oa_table_t *table, char *key);
+void ht_oa_delete_all(ht_oa_table_t *table);
+void ht_oa_free(ht_oa_table_t *table);
+bool ht_oa_resize(ht_oa_table_t *table, int size);
+float ht_oa_load_factor(ht_oa_table_t *table);
+
+#endif
+
+/* End of hashtable_oa.h */
@@ -0,0 +1,686 @@
+/**
+ * @file hashtable_rcu.c
+ * @brief Read-mostly concurrent hashtable with lock-free readers (RCU style).
+ * @details Built for workloads dominated by lookups. Readers never lock and never write
+ *          shared memory other than their own reader slot: they load the bucket array and
+ *          the `next` pointers with acquire loads and walk the synonym lists while writers
+ *          keep changing them. Writers are serialized by a mutex and publish every change
+ *          with a single release store:
+ *          - an insertion fills the new item completely and then stores it as the head of
+ *            its synonym list,
+ *          - a deletion stores the successor of the item into the link pointing to it; the
+ *            unlinked item keeps its own `next`, so a reader standing on it can continue,
+ *          - growing the table copies the items into a new bucket array and then stores the
+ *            array pointer; readers finish their walk in the old array.
+ *
+ *          Unlinked items and replaced arrays cannot be freed at once, since readers may
+ *          still hold pointers to them. They are reclaimed by epochs: a reader announces the
+ *          global epoch in its slot for the duration of a lookup, a writer retires memory
+ *          into the list of the current epoch, and the epoch advances only when every active
+ *          reader has announced it. Two advances later no reader can still see the retired
+ *          memory, and the list is freed. Readers thus pay one store and one fence per
+ *          lookup, on a cache line of their own, so reader throughput scales with the cores.
+ *
+ *          Key functions implemented:
+ *          - ht_rcu_init: Initializes the table.
+ *          - ht_rcu_register / ht_rcu_unregister: Claim and release a reader slot.
+ *          - ht_rcu_contains: Tests whether a key is in the table (lock-free).
+ *          - ht_rcu_get: Copies an item's value out of the table (lock-free).
+ *          - ht_rcu_insert: Inserts a new item or updates an existing one.
+ *          - ht_rcu_delete: Unlinks an item and retires it.
+ *          - ht_rcu_reclaim: Frees retired memory no reader can see anymore.
+ *          - ht_rcu_count: Returns the number of items.
+ *          - ht_rcu_free: Releases the table.
+ *
+ * @code
+ * ht_rcu_table_t my_table;
+ * ht_rcu_init(&my_table, 0);
+ * ht_rcu_insert(&my_table, "key1", 1.0f); // from any thread
+ * // in a reader thread:
+ * int reader = ht_rcu_register(&my_table);
+ * float value;
+ * if (ht_rcu_get(&my_table, reader, "key1", &value)) {
+ *     printf("Found value: %f\n", value);
+ * }
+ * ht_rcu_unregister(&my_table, reader);
+ * // once all threads are done:
+ * ht_rcu_free(&my_table);
+ * @endcode
+ *
+ * @see hashtable_rcu.h for type definitions and constants.
+ * @see hashtable_shard.c for the lock-based concurrent table.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project02-2021 for the project repository.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "hashtable_rcu.h"
+#include "hashtable_dyn.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Defined in hashtable.c, string.h does not declare it in strict C11 mode
+char *strdup(const char *s);
+
+/**
+ * @brief Computes the full hash of a key.
+ *
+ * @param table A pointer to an initialized table.
+ * @param key The string key to hash.
+ *
+ * @return The 64-bit hash value; the bucket index is the value reduced by the table size.
+ */
+static inline uint64_t ht_rcu_hash_key(ht_rcu_table_t *table, const char *key) {
+    return HT_RCU_HASH(key, strlen(key), table->seed);
+}
+
+/**
+ * @brief Allocates an empty bucket array with 'size' buckets.
+ *
+ * @param size The number of buckets.
+ *
+ * @retval NULL Memory allocation failed.
+ * @return A pointer to the array.
+ */
+static ht_rcu_buckets_t *ht_rcu_new_buckets(int size) {
+    ht_rcu_buckets_t *buckets = malloc(sizeof(ht_rcu_buckets_t) + size * sizeof(buckets->items[0]));
+    if (buckets == NULL) {
+        return NULL;
+    }
+    buckets->size = size;
+    buckets->retired_next = NULL;
+    for (int i = 0; i < size; i++) {
+        atomic_init(&buckets->items[i], NULL);
+    }
+    return buckets;
+}
+
+/**
+ * @brief Allocates an item with a copy of its key.
+ *
+ * @details Keys shorter than `HT_INLINE_KEY_SIZE` are stored inside the item.
+ *
+ * @param key The key to be copied into the item.
+ * @param hash The full hash of 'key'.
+ * @param value The value of the item.
+ *
+ * @retval NULL Memory allocation failed.
+ * @return A pointer to the item, not linked into any list yet.
+ */
+static ht_rcu_item_t *ht_rcu_new_item(const char *key, uint64_t hash, float value) {
+    ht_rcu_item_t *item = malloc(sizeof(ht_rcu_item_t));
+    if (item == NULL) {
+        return NULL;
+    }
+    size_t length = strlen(key) + 1;
+    if (length <= HT_INLINE_KEY_SIZE) {
+        memcpy(item->inline_key, key, length);
+        item->key = item->inline_key;
+    }
+    else {
+        item->key = strdup(key);
+        if (item->key == NULL) {
+            free(item);
+            return NULL;
+        }
+    }
+    atomic_init(&item->value, value);
+    atomic_init(&item->next, NULL);
+    item->hash = hash;
+    item->retired_next = NULL;
+    return item;
+}
+
+/**
+ * @brief Frees an item together with its key.
+ *
+ * @param item The item to free; no reader may reference it anymore.
+ *
+ * @return This function does not return a value.
+ */
+static void ht_rcu_free_item(ht_rcu_item_t *item) {
+    if (item->key != item->inline_key) {
+        free(item->key);
+    }
+    free(item);
+}
+
+/**
+ * @brief Frees the memory retired in one epoch.
+ *
+ * @param table A pointer to an initialized table.
+ * @param slot The index of the epoch's retire lists.
+ *
+ * @return This function does not return a value.
+ */
+static void ht_rcu_free_retired(ht_rcu_table_t *table, int slot) {
+    while (table->retired_items[slot] != NULL) {
+        ht_rcu_item_t *item = table->retired_items[slot];
+        table->retired_items[slot] = item->retired_next;
+        ht_rcu_free_item(item);
+    }
+    while (table->retired_buckets[slot] != NULL) {
+        ht_rcu_buckets_t *buckets = table->retired_buckets[slot];
+        table->retired_buckets[slot] = buckets->retired_next;
+        free(buckets);
+    }
+}
+
+/**
+ * @brief Advances the global epoch if every active reader has announced it.
+ *
+ * @details Memory retired two epochs before the new one is unreachable for all readers:
+ *          every reader that might have seen it has announced a later epoch or finished.
+ *          That memory is freed and its retire lists are reused for the new epoch.
+ *
+ * @param table A pointer to an initialized table.
+ *
+ * @pre The caller holds the write lock.
+ *
+ * @retval true The epoch was advanced.
+ * @retval false A reader is still in an older epoch.
+ */
+static bool ht_rcu_try_advance(ht_rcu_table_t *table) {
+    // Orders the unlinking stores before the reads of the reader slots
+    atomic_thread_fence(memory_order_seq_cst);
+
+    uint_fast64_t epoch = atomic_load_explicit(&table->epoch, memory_order_relaxed);
+    for (int i = 0; i < HT_RCU_MAX_READERS; i++) {
+        uint_fast64_t state = atomic_load_explicit(&table->readers[i].state, memory_order_acquire);
+        if ((state & 1) != 0 && (state >> 1) != epoch) {
+            return false;
+        }
+    }
+    atomic_store_explicit(&table->epoch, epoch + 1, memory_order_release);
+    ht_rcu_free_retired(table, (int) ((epoch + 2) % HT_RCU_EPOCHS));
+    return true;
+}
+
+/**
+ * @brief Retires an unlinked item into the list of the current epoch.
+ *
+ * @param table A pointer to an initialized table.
+ * @param item The item that was unlinked from its synonym list.
+ *
+ * @pre The caller holds the write lock.
+ *
+ * @return This function does not return a value.
+ */
+static void ht_rcu_retire_item(ht_rcu_table_t *table, ht_rcu_item_t *item) {
+    int slot = (int) (atomic_load_explicit(&table->epoch, memory_order_relaxed) % HT_RCU_EPOCHS);
+    item->retired_next = table->retired_items[slot];
+    table->retired_items[slot] = item;
+}
+
+/**
+ * @brief Starts a lookup of a reader: announces the current epoch in its slot.
+ *
+ * @param table A pointer to an initialized table.
+ * @param reader The reader's slot index.
+ *
+ * @return This function does not return a value.
+ */
+static inline void ht_rcu_read_enter(ht_rcu_table_t *table, int reader) {
+    uint_fast64_t epoch = atomic_load_explicit(&table->epoch, memory_order_acquire);
+    atomic_store_explicit(&table->readers[reader].state, (epoch << 1) | 1, memory_order_relaxed);
+    // Orders the announcement before the loads of the table's pointers
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+/**
+ * @brief Ends a lookup of a reader: marks its slot as quiescent.
+ *
+ * @param table A pointer to an initialized table.
+ * @param reader The reader's slot index.
+ *
+ * @return This function does not return a value.
+ */
+static inline void ht_rcu_read_exit(ht_rcu_table_t *table, int reader) {
+    atomic_store_explicit(&table->readers[reader].state, 0, memory_order_release);
+}
+
+/**
+ * @brief Walks the synonym list of a key without locking.
+ *
+ * @param buckets The bucket array loaded by the reader or writer.
+ * @param key The key to search for.
+ * @param hash The full hash of 'key'.
+ *
+ * @retval NULL The key is not in the table.
+ * @return A pointer to the found item.
+ */
+static ht_rcu_item_t *ht_rcu_find(ht_rcu_buckets_t *buckets, const char *key, uint64_t hash) {
+    ht_rcu_item_t *cellElement = atomic_load_explicit(&buckets->items[hash % (uint64_t) buckets->size],
+                                                      memory_order_acquire);
+    while (cellElement != NULL) {
+        if (cellElement->hash == hash && strcmp(cellElement->key, key) == 0) {
+            return cellElement;
+        }
+        cellElement = atomic_load_explicit(&cellElement->next, memory_order_acquire);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Initializes a read-mostly concurrent hashtable.
+ *
+ * @details Allocates a bucket array with a prime number of buckets (at least 'size', or
+ *          HT_RCU_DEFAULT_SIZE when 'size' is not positive) and frees all reader slots.
+ *
+ * @param table A pointer to the table to be initialized.
+ * @param size The requested initial number of buckets.
+ *
+ * @pre 'table' must not reference an initialized table, otherwise its memory is leaked.
+ *
+ * @post On success, the table is empty and may be shared between threads.
+ *
+ * @warning Initialization itself is not thread-safe; it must complete before the table
+ *          is shared.
+ *
+ * @retval true The table was initialized.
+ * @retval false 'table' is NULL or memory allocation failed.
+ */
+bool ht_rcu_init(ht_rcu_table_t *table, int size) {
+
+    // Check for NULL
+    if (table == NULL) {
+        return false;
+    }
+
+    ht_rcu_buckets_t *buckets = ht_rcu_new_buckets(ht_dyn_next_prime(size > 0 ? size : HT_RCU_DEFAULT_SIZE));
+    if (buckets == NULL) {
+        atomic_init(&table->buckets, NULL);
+        return false;
+    }
+    if (pthread_mutex_init(&table->write_lock, NULL) != 0) {
+        free(buckets);
+        atomic_init(&table->buckets, NULL);
+        return false;
+    }
+    atomic_init(&table->buckets, buckets);
+    atomic_init(&table->epoch, 0);
+    for (int i = 0; i < HT_RCU_MAX_READERS; i++) {
+        atomic_init(&table->readers[i].state, 0);
+        atomic_init(&table->readers[i].used, false);
+    }
+    for (int i = 0; i < HT_RCU_EPOCHS; i++) {
+        table->retired_items[i] = NULL;
+        table->retired_buckets[i] = NULL;
+    }
+    table->count = 0;
+    table->max_load = HT_RCU_MAX_LOAD;
+    table->seed[0] = 0;
+    table->seed[1] = 0;
+    return true;
+}
+
+/**
+ * @brief Claims a reader slot for the calling thread.
+ *
+ * @details Every thread that reads the table needs a slot of its own, where it announces
+ *          the epoch of its lookups. Claiming a slot is lock-free.
+ *
+ * @param table A pointer to an initialized table.
+ *
+ * @code
+ * int reader = ht_rcu_register(&my_table);
+ * // ... lookups with 'reader' ...
+ * ht_rcu_unregister(&my_table, reader);
+ * @endcode
+ *
+ * @warning A slot must not be used by two threads at the same time.
+ *
+ * @retval -1 All HT_RCU_MAX_READERS slots are taken or 'table' is NULL.
+ * @return The index of the claimed slot.
+ */
+int ht_rcu_register(ht_rcu_table_t *table) {
+
+    // Check for NULL
+    if (table == NULL) {
+        return -1;
+    }
+
+    for (int i = 0; i < HT_RCU_MAX_READERS; i++) {
+        bool expected = false;
+        if (atomic_compare_exchange_strong(&table->readers[i].used, &expected, true)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Releases a reader slot claimed by `ht_rcu_register`.
+ *
+ * @param table A pointer to an initialized table.
+ * @param reader The index of the slot.
+ *
+ * @pre The reader is not inside a lookup.
+ *
+ * @return This function does not return a value.
+ */
+void ht_rcu_unregister(ht_rcu_table_t *table, int reader) {
+    if (table == NULL || reader < 0 || reader >= HT_RCU_MAX_READERS) {
+        return;
+    }
+    atomic_store(&table->readers[reader].state, 0);
+    atomic_store(&table->readers[reader].used, false);
+}
+
+/**
+ * @brief Tests whether a key is in the table without locking.
+ *
+ * @param table A pointer to an initialized table.
+ * @param reader The caller's reader slot, see `ht_rcu_register`.
+ * @param key The key to search for.
+ *
+ * @pre 'key' must be a null-terminated string.
+ *
+ * @retval true The key is in the table.
+ * @retval false The key is not in the table, or 'table' or 'reader' is invalid.
+ */
+bool ht_rcu_contains(ht_rcu_table_t *table, int reader, char *key) {
+    float value;
+    return ht_rcu_get(table, reader, key, &value);
+}
+
+/**
+ * @brief Copies the value associated with a key out of the table without locking.
+ *
+ * @details Announces the current epoch, walks the synonym list with acquire loads and
+ *          copies the value before leaving the epoch, so the item may be retired right
+ *          afterwards. Lookups running concurrently with writers see every item either
+ *          entirely before or entirely after a change.
+ *
+ * @param table A pointer to an initialized table.
+ * @param reader The caller's reader slot, see `ht_rcu_register`.
+ * @param key The key string associated with the desired value.
+ * @param value Receives the value when the key is found; left untouched otherwise.
+ *
+ * @pre 'key' must be a null-terminated string.
+ *
+ * @code
+ * float value;
+ * if (ht_rcu_get(&my_table, reader, "my_key", &value)) {
+ *     // use value
+ * }
+ * @endcode
+ *
+ * @retval true The key was found and its value copied.
+ * @retval false The key was not found, or 'table', 'reader' or 'value' is invalid.
+ */
+bool ht_rcu_get(ht_rcu_table_t *table, int reader, char *key, float *value) {
+
+    // Check for NULL
+    if (table == NULL || value == NULL || reader < 0 || reader >= HT_RCU_MAX_READERS) {
+        return false;
+    }
+
+    uint64_t hash = ht_rcu_hash_key(table, key);
+    ht_rcu_read_enter(table, reader);
+    ht_rcu_buckets_t *buckets = atomic_load_explicit(&table->buckets, memory_order_acquire);
+    ht_rcu_item_t *element = buckets != NULL ? ht_rcu_find(buckets, key, hash) : NULL;
+    if (element != NULL) {
+        *value = atomic_load_explicit(&element->value, memory_order_relaxed);
+    }
+    ht_rcu_read_exit(table, reader);
+    return element != NULL;
+}
+
+/**
+ * @brief Replaces the bucket array with a larger one.
+ *
+ * @details Readers may be walking the current lists, so the items are not relinked:
+ *          every item is copied into the new array, the array is published with a release
+ *          store, and the old array and items are retired.
+ *
+ * @param table A pointer to an initialized table.
+ * @param size The requested number of buckets.
+ *
+ * @pre The caller holds the write lock.
+ *
+ * @retval true The table was grown.
+ * @retval false Memory allocation failed; the table is unchanged.
+ */
+static bool ht_rcu_grow(ht_rcu_table_t *table, int size) {
+    ht_rcu_buckets_t *oldBuckets = atomic_load_explicit(&table->buckets, memory_order_relaxed);
+    ht_rcu_buckets_t *newBuckets = ht_rcu_new_buckets(ht_dyn_next_prime(size));
+    if (newBuckets == NULL) {
+        return false;
+    }
+
+    // Copy the items, nothing is visible to readers yet
+    for (int i = 0; i < oldBuckets->size; i++) {
+        ht_rcu_item_t *current = atomic_load_explicit(&oldBuckets->items[i], memory_order_relaxed);
+        for (; current != NULL; current = atomic_load_explicit(&current->next, memory_order_relaxed)) {
+            ht_rcu_item_t *copy = ht_rcu_new_item(current->key, current->hash,
+                                                  atomic_load_explicit(&current->value, memory_order_relaxed));
+            if (copy == NULL) {
+                // Free the partial copy, it was never published
+                for (int j = 0; j < newBuckets->size; j++) {
+                    ht_rcu_item_t *item = atomic_load_explicit(&newBuckets->items[j], memory_order_relaxed);
+                    while (item != NULL) {
+                        ht_rcu_item_t *nextItem = atomic_load_explicit(&item->next, memory_order_relaxed);
+                        ht_rcu_free_item(item);
+                        item = nextItem;
+                    }
+                }
+                free(newBuckets);
+                return false;
+            }
+            int index = (int) (copy->hash % (uint64_t) newBuckets->size);
+            atomic_store_explicit(&copy->next, atomic_load_explicit(&newBuckets->items[index], memory_order_relaxed),
+                                  memory_order_relaxed);
+            atomic_store_explicit(&newBuckets->items[index], copy, memory_order_relaxed);
+        }
+    }
+
+    // Publish the new array, then retire the old one with its items
+    atomic_store_explicit(&table->buckets, newBuckets, memory_order_release);
+    for (int i = 0; i < oldBuckets->size; i++) {
+        ht_rcu_item_t *current = atomic_load_explicit(&oldBuckets->items[i], memory_order_relaxed);
+        while (current != NULL) {
+            ht_rcu_item_t *nextItem = atomic_load_explicit(&current->next, memory_order_relaxed);
+            ht_rcu_retire_item(table, current);
+            current = nextItem;
+        }
+    }
+    int slot = (int) (atomic_load_explicit(&table->epoch, memory_order_relaxed) % HT_RCU_EPOCHS);
+    oldBuckets->retired_next = table->retired_buckets[slot];
+    table->retired_buckets[slot] = oldBuckets;
+    return true;
+}
+
+/**
+ * @brief Inserts or updates an item in the table.
+ *
+ * @details Takes the write lock. An existing item gets the new value with an atomic
+ *          store. A new item is filled completely and then published as the head of its
+ *          synonym list with a release store, so readers never see it half-initialized.
+ *          Before adding, the table grows when the new item would exceed the load factor
+ *          limit.
+ *
+ * @param table A pointer to an initialized table.
+ * @param key The key associated with the item.
+ * @param value The value to be inserted or updated.
+ *
+ * @pre 'key' must be a null-terminated string.
+ *
+ * @code
+ * ht_rcu_insert(&my_table, "key1", 1.0f);
+ * @endcode
+ *
+ * @warning If allocating the item fails, the insertion is not completed.
+ *
+ * @return This function does not return a value.
+ */
+void ht_rcu_insert(ht_rcu_table_t *table, char *key, float value) {
+
+    // Check for NULL
+    if (table == NULL || atomic_load_explicit(&table->buckets, memory_order_relaxed) == NULL) {
+        return;
+    }
+
+    uint64_t hash = ht_rcu_hash_key(table, key);
+    pthread_mutex_lock(&table->write_lock);
+
+    ht_rcu_buckets_t *buckets = atomic_load_explicit(&table->buckets, memory_order_relaxed);
+    ht_rcu_item_t *element = ht_rcu_find(buckets, key, hash);
+    if (element != NULL) {
+        atomic_store_explicit(&element->value, value, memory_order_relaxed);
+        pthread_mutex_unlock(&table->write_lock);
+        return;
+    }
+
+    // Grow the table before the load factor limit is exceeded
+    if (table->max_load > 0 && table->count + 1 > table->max_load * buckets->size) {
+        if (ht_rcu_grow(table, 2 * buckets->size)) {
+            buckets = atomic_load_explicit(&table->buckets, memory_order_relaxed);
+            ht_rcu_try_advance(table);
+        }
+    }
+
+    ht_rcu_item_t *newElement = ht_rcu_new_item(key, hash, value);
+    if (newElement != NULL) {
+        int index = (int) (hash % (uint64_t) buckets->size);
+        atomic_store_explicit(&newElement->next, atomic_load_explicit(&buckets->items[index], memory_order_relaxed),
+                              memory_order_relaxed);
+        // Publish the fully initialized item
+        atomic_store_explicit(&buckets->items[index], newElement, memory_order_release);
+        table->count++;
+    }
+    pthread_mutex_unlock(&table->write_lock);
+}
+
+/**
+ * @brief Removes an item with the specified key from the table.
+ *
+ * @details Takes the write lock and unlinks the item with a release store of its
+ *          successor. The item is not freed: readers may still be standing on it, so it
+ *          is retired and freed by a later epoch advance.
+ *
+ * @param table A pointer to an initialized table.
+ * @param key The key of the item to delete.
+ *
+ * @pre 'key' must be a null-terminated string.
+ *
+ * @post The item is no longer reachable for new lookups.
+ *
+ * @return This function does not return a value.
+ */
+void ht_rcu_delete(ht_rcu_table_t *table, char *key) {
+
+    // Check for NULL
+    if (table == NULL || atomic_load_explicit(&table->buckets, memory_order_relaxed) == NULL) {
+        return;
+    }
+
+    uint64_t hash = ht_rcu_hash_key(table, key);
+    pthread_mutex_lock(&table->write_lock);
+
+    ht_rcu_buckets_t *buckets = atomic_load_explicit(&table->buckets, memory_order_relaxed);
+    _Atomic(ht_rcu_item_t *) *link = &buckets->items[hash % (uint64_t) buckets->size];
+    ht_rcu_item_t *cellElement;
+    while ((cellElement = atomic_load_explicit(link, memory_order_relaxed)) != NULL) {
+        if (cellElement->hash == hash && strcmp(cellElement->key, key) == 0) {
+            // The item keeps its 'next', readers standing on it can continue
+            atomic_store_explicit(link, atomic_load_explicit(&cellElement->next, memory_order_relaxed),
+                                  memory_order_release);
+            ht_rcu_retire_item(table, cellElement);
+            table->count--;
+            ht_rcu_try_advance(table);
+            break;
+        }
+        link = &cellElement->next;
+    }
+    pthread_mutex_unlock(&table->write_lock);
+}
+
+/**
+ * @brief Frees retired memory that no reader can reach anymore.
+ *
+ * @details Writers reclaim memory as they go; this function lets an otherwise idle
+ *          writer finish the job. Readers currently inside a lookup may keep the latest
+ *          retirements alive.
+ *
+ * @param table A pointer to an initialized table.
+ *
+ * @return This function does not return a value.
+ */
+void ht_rcu_reclaim(ht_rcu_table_t *table) {
+
+    // Check for NULL
+    if (table == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&table->write_lock);
+    for (int i = 0; i < HT_RCU_EPOCHS - 1; i++) {
+        if (!ht_rcu_try_advance(table)) {
+            break;
+        }
+    }
+    pthread_mutex_unlock(&table->write_lock);
+}
+
+/**
+ * @brief Returns the number of items in the table.
+ *
+ * @param table A pointer to the table.
+ *
+ * @return The number of items, or 0 for a NULL table.
+ */
+int ht_rcu_count(ht_rcu_table_t *table) {
+
+    // Check for NULL
+    if (table == NULL) {
+        return 0;
+    }
+
+    pthread_mutex_lock(&table->write_lock);
+    int count = table->count;
+    pthread_mutex_unlock(&table->write_lock);
+    return count;
+}
+
+/**
+ * @brief Releases the table together with all its items and retired memory.
+ *
+ * @param table A pointer to the table.
+ *
+ * @pre No other thread may use the table during or after the call.
+ *
+ * @post The table holds no memory and must be initialized again before further use.
+ *
+ * @return This function does not return a value.
+ */
+void ht_rcu_free(ht_rcu_table_t *table) {
+
+    // Check for NULL
+    if (table == NULL) {
+        return;
+    }
+
+    ht_rcu_buckets_t *buckets = atomic_load_explicit(&table->buckets, memory_order_relaxed);
+    if (buckets == NULL) {
+        return;
+    }
+    for (int i = 0; i < buckets->size; i++) {
+        ht_rcu_item_t *current = atomic_load_explicit(&buckets->items[i], memory_order_relaxed);
+        while (current != NULL) {
+            ht_rcu_item_t *nextItem = atomic_load_explicit(&current->next, memory_order_relaxed);
+            ht_rcu_free_item(current);
+            current = nextItem;
+        }
+    }
+    free(buckets);
+    for (int i = 0; i < HT_RCU_EPOCHS; i++) {
+        ht_rcu_free_retired(table, i);
+    }
+    pthread_mutex_destroy(&table->write_lock);
+    atomic_store_explicit(&table->buckets, NULL, memory_order_relaxed);
+    table->count = 0;
+}
+
+/* End of hashtable_rcu.c */
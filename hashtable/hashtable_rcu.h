@@ -0,0 +1,87 @@
+/*
+ * Header file for the read-mostly concurrent hash table. Readers walk the
+ * synonym lists with atomic loads and take no locks; writers are serialized
+ * by a mutex and publish their changes with release stores. Unlinked items
+ * are freed through epoch-based reclamation once no reader can see them.
+ * Translation units including this header must be compiled with -pthread
+ * and define _POSIX_C_SOURCE (200809L) before including any system header.
+ */
+
+#ifndef IAL_HASHTABLE_RCU_H
+#define IAL_HASHTABLE_RCU_H
+
+#include "hashtable.h"
+#include "ht_hash.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// Bucket count used when ht_rcu_init is given a non-positive size
+#define HT_RCU_DEFAULT_SIZE 13
+
+// Load factor (items per bucket) that triggers growth
+#define HT_RCU_MAX_LOAD 0.75f
+
+// Hash function of the keys
+#define HT_RCU_HASH ht_hash_fnv1a
+
+// Maximum number of reader threads registered at the same time
+#define HT_RCU_MAX_READERS 64
+
+// Assumed cache line size, reader slots are aligned to it to avoid false sharing
+#define HT_RCU_CACHE_LINE 64
+
+// Number of epochs whose retired memory is kept
+#define HT_RCU_EPOCHS 3
+
+// Table item, 'next' and 'value' may change while readers use the item
+typedef struct ht_rcu_item {
+  char *key;                           // key, points to 'inline_key' if short
+  _Atomic float value;                 // value
+  _Atomic(struct ht_rcu_item *) next;  // pointer to the next synonym
+  uint64_t hash;                       // full hash of the key
+  struct ht_rcu_item *retired_next;    // next item retired in the same epoch
+  char inline_key[HT_INLINE_KEY_SIZE]; // storage of short keys
+} ht_rcu_item_t;
+
+// Bucket array, replaced as a whole when the table grows
+typedef struct ht_rcu_buckets {
+  int size;                            // number of buckets, a prime number
+  struct ht_rcu_buckets *retired_next; // next array retired in the same epoch
+  _Atomic(ht_rcu_item_t *) items[];    // synonym lists
+} ht_rcu_buckets_t;
+
+// Epoch announcement of one reader thread
+typedef struct ht_rcu_reader {
+  _Alignas(HT_RCU_CACHE_LINE) atomic_uint_fast64_t state; // 0 or (epoch << 1) | 1
+  atomic_bool used; // the slot belongs to a registered reader
+} ht_rcu_reader_t;
+
+// Read-mostly table
+typedef struct ht_rcu_table {
+  _Atomic(ht_rcu_buckets_t *) buckets;         // current bucket array
+  atomic_uint_fast64_t epoch;                  // global epoch, advanced by writers
+  ht_rcu_reader_t readers[HT_RCU_MAX_READERS]; // reader slots
+  pthread_mutex_t write_lock;                  // serializes writers
+  int count;                                   // number of items, writers only
+  float max_load;   // load factor limit, growth is disabled when <= 0
+  uint64_t seed[2]; // seed passed to the hash function
+  ht_rcu_item_t *retired_items[HT_RCU_EPOCHS];      // unlinked items by epoch
+  ht_rcu_buckets_t *retired_buckets[HT_RCU_EPOCHS]; // replaced arrays by epoch
+} ht_rcu_table_t;
+
+bool ht_rcu_init(ht_rcu_table_t *table, int size);
+int ht_rcu_register(ht_rcu_table_t *table);
+void ht_rcu_unregister(ht_rcu_table_t *table, int reader);
+bool ht_rcu_contains(ht_rcu_table_t *table, int reader, char *key);
+bool ht_rcu_get(ht_rcu_table_t *table, int reader, char *key, float *value);
+void ht_rcu_insert(ht_rcu_table_t *table, char *key, float value);
+void ht_rcu_delete(ht_rcu_table_t *table, char *key);
+void ht_rcu_reclaim(ht_rcu_table_t *table);
+int ht_rcu_count(ht_rcu_table_t *table);
+void ht_rcu_free(ht_rcu_table_t *table);
+
+#endif
+
+/* End of hashtable_rcu.h */
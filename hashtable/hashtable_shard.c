@@ -0,0 +1,346 @@
+/**
+ * @file hashtable_shard.c
+ * @brief Thread-safe hashtable partitioned into independently locked stripes.
+ * @details The fixed and the growable tables are not safe to use from several threads
+ *          (the fixed one even depends on the mutable global `HT_SIZE`). This variant
+ *          splits the key space into `stripe_count` stripes: the hash of a key selects
+ *          its stripe, and every stripe is a growable table (see hashtable_dyn.c) guarded
+ *          by its own `pthread_rwlock_t`. The stripes use the hash function of the whole
+ *          table, so a key is hashed once: the upper half of the hash selects the stripe
+ *          and the `_hashed` functions of the stripe's table reuse it for the bucket. Lookups take the stripe's lock for reading, so
+ *          any number of them run in parallel (the lookups of the growable table never
+ *          write to it, not even during a rehash); modifications take it for writing and only
+ *          block the operations on the same stripe. Each stripe grows on its own, under
+ *          its own lock, so a rehash never stops the whole table.
+ *
+ *          Every stripe sits on its own cache line, so that threads locking neighbouring
+ *          stripes do not invalidate each other's cache lines (false sharing).
+ *
+ *          Key functions implemented:
+ *          - ht_shard_init: Initializes the stripes of the table.
+ *          - ht_shard_contains: Tests whether a key is in the table.
+ *          - ht_shard_insert: Inserts a new item or updates an existing one.
+ *          - ht_shard_get: Copies an item's value out of the table.
+ *          - ht_shard_delete: Removes an item from the table.
+ *          - ht_shard_delete_all: Deletes all items from the table.
+ *          - ht_shard_free: Releases the table.
+ *          - ht_shard_count: Returns the number of items.
+ *
+ * @code
+ * ht_shard_table_t my_table;
+ * ht_shard_init(&my_table, 64, 0);
+ * // from any thread:
+ * ht_shard_insert(&my_table, "key1", 1.0f);
+ * float value;
+ * if (ht_shard_get(&my_table, "key1", &value)) {
+ *     printf("Found value: %f\n", value);
+ * }
+ * // once all threads are done:
+ * ht_shard_free(&my_table);
+ * @endcode
+ *
+ * @note Items never leave the table through the API: `ht_shard_get` copies the value
+ *       while the lock is held, because a pointer to it could be invalidated by another
+ *       thread as soon as the lock is released.
+ *
+ * @see hashtable_shard.h for type definitions and constants.
+ * @see hashtable_dyn.c for the table of a stripe.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project02-2021 for the project repository.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "hashtable_shard.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Selects the stripe of a key by its hash.
+ *
+ * @details Uses the upper half of the hash, so that the stripe does not depend on the
+ *          same bits as the bucket index inside the stripe's table, which reduces the
+ *          same hash by its size.
+ *
+ * @param table A pointer to an initialized table.
+ * @param hash The hash of the key, computed with the table's hash function and seed.
+ *
+ * @return A pointer to the stripe holding the key.
+ */
+static inline ht_shard_stripe_t *ht_shard_stripe(ht_shard_table_t *table, uint64_t hash) {
+    return &table->stripes[(hash >> 32) % (uint64_t) table->stripe_count];
+}
+
+/**
+ * @brief Initializes a sharded hashtable.
+ *
+ * @details Allocates `stripe_count` cache-line aligned stripes and initializes the lock
+ *          and the growable table of each. The requested initial size is divided evenly
+ *          among the stripes.
+ *
+ * @param table A pointer to the table to be initialized.
+ * @param stripe_count The number of stripes, HT_SHARD_DEFAULT_STRIPES when not positive.
+ * @param size The requested initial number of buckets of the whole table.
+ *
+ * @pre 'table' must not reference an initialized table, otherwise its memory is leaked.
+ *
+ * @post On success, the table is empty and may be used from several threads.
+ *
+ * @code
+ * ht_shard_table_t my_table;
+ * ht_shard_init(&my_table, 4 * thread_count, 100000);
+ * @endcode
+ *
+ * @note A few stripes per thread keep contention low; more stripes than that only cost
+ *       memory.
+ *
+ * @warning Initialization itself is not thread-safe; it must complete before the table
+ *          is shared.
+ *
+ * @retval true The table was initialized.
+ * @retval false 'table' is NULL or memory allocation failed.
+ */
+bool ht_shard_init(ht_shard_table_t *table, int stripe_count, int size) {
+
+    // Check for NULL
+    if (table == NULL) {
+        return false;
+    }
+
+    if (stripe_count <= 0) {
+        stripe_count = HT_SHARD_DEFAULT_STRIPES;
+    }
+    table->stripes = aligned_alloc(HT_SHARD_CACHE_LINE, stripe_count * sizeof(ht_shard_stripe_t));
+    if (table->stripes == NULL) {
+        table->stripe_count = 0;
+        return false;
+    }
+    table->hash = HT_SHARD_HASH;
+    table->seed[0] = 0;
+    table->seed[1] = 0;
+
+    for (int i = 0; i < stripe_count; i++) {
+        ht_shard_stripe_t *stripe = &table->stripes[i];
+        bool locked = pthread_rwlock_init(&stripe->lock, NULL) == 0;
+        if (!locked || !ht_dyn_init(&stripe->table, size / stripe_count)) {
+            // Undo the stripes initialized so far
+            if (locked) {
+                pthread_rwlock_destroy(&stripe->lock);
+            }
+            table->stripe_count = i;
+            ht_shard_free(table);
+            return false;
+        }
+        // The stripe hashes with the function of the table, see ht_shard_stripe;
+        // selecting it cannot fail while the stripe is empty
+        ht_dyn_set_hash(&stripe->table, table->hash, table->seed);
+    }
+    table->stripe_count = stripe_count;
+    return true;
+}
+
+/**
+ * @brief Tests whether a key is in the table.
+ *
+ * @details Takes the lock of the key's stripe for reading.
+ *
+ * @param table A pointer to the table.
+ * @param key The key to search for.
+ *
+ * @pre 'table' must be initialized. 'key' must be a null-terminated string.
+ *
+ * @retval true The key is in the table.
+ * @retval false The key is not in the table or 'table' is NULL.
+ */
+bool ht_shard_contains(ht_shard_table_t *table, char *key) {
+
+    // Check for NULL
+    if (table == NULL || table->stripes == NULL) {
+        return false;
+    }
+
+    uint64_t hash = table->hash(key, strlen(key), table->seed);
+    ht_shard_stripe_t *stripe = ht_shard_stripe(table, hash);
+    pthread_rwlock_rdlock(&stripe->lock);
+    bool found = ht_dyn_search_hashed(&stripe->table, key, hash) != NULL;
+    pthread_rwlock_unlock(&stripe->lock);
+    return found;
+}
+
+/**
+ * @brief Inserts or updates an item in the table.
+ *
+ * @details Takes the lock of the key's stripe for writing, see `ht_dyn_insert`.
+ *
+ * @param table A pointer to the table.
+ * @param key The key associated with the item.
+ * @param value The value to be inserted or updated.
+ *
+ * @pre 'table' must be initialized. 'key' must be a null-terminated string.
+ *
+ * @code
+ * ht_shard_insert(&my_table, "key1", 1.0f);
+ * @endcode
+ *
+ * @return This function does not return a value.
+ */
+void ht_shard_insert(ht_shard_table_t *table, char *key, float value) {
+
+    // Check for NULL
+    if (table == NULL || table->stripes == NULL) {
+        return;
+    }
+
+    uint64_t hash = table->hash(key, strlen(key), table->seed);
+    ht_shard_stripe_t *stripe = ht_shard_stripe(table, hash);
+    pthread_rwlock_wrlock(&stripe->lock);
+    ht_dyn_insert_hashed(&stripe->table, key, hash, value);
+    pthread_rwlock_unlock(&stripe->lock);
+}
+
+/**
+ * @brief Copies the value associated with a key out of the table.
+ *
+ * @details Takes the lock of the key's stripe for reading and copies the value before
+ *          releasing it.
+ *
+ * @param table A pointer to the table.
+ * @param key The key string associated with the desired value.
+ * @param value Receives the value when the key is found; left untouched otherwise.
+ *
+ * @pre 'table' must be initialized. 'key' must be a null-terminated string.
+ *
+ * @code
+ * float value;
+ * if (ht_shard_get(&my_table, "my_key", &value)) {
+ *     // use value
+ * }
+ * @endcode
+ *
+ * @retval true The key was found and its value copied.
+ * @retval false The key was not found, or 'table' or 'value' is NULL.
+ */
+bool ht_shard_get(ht_shard_table_t *table, char *key, float *value) {
+
+    // Check for NULL
+    if (table == NULL || table->stripes == NULL || value == NULL) {
+        return false;
+    }
+
+    uint64_t hash = table->hash(key, strlen(key), table->seed);
+    ht_shard_stripe_t *stripe = ht_shard_stripe(table, hash);
+    pthread_rwlock_rdlock(&stripe->lock);
+    ht_item_t *element = ht_dyn_search_hashed(&stripe->table, key, hash);
+    if (element != NULL) {
+        *value = element->value;
+    }
+    pthread_rwlock_unlock(&stripe->lock);
+    return element != NULL;
+}
+
+/**
+ * @brief Removes an item with the specified key from the table.
+ *
+ * @details Takes the lock of the key's stripe for writing, see `ht_dyn_delete`.
+ *
+ * @param table A pointer to the table.
+ * @param key The key of the item to delete.
+ *
+ * @pre 'table' must be initialized. 'key' must be a null-terminated string.
+ *
+ * @return This function does not return a value.
+ */
+void ht_shard_delete(ht_shard_table_t *table, char *key) {
+
+    // Check for NULL
+    if (table == NULL || table->stripes == NULL) {
+        return;
+    }
+
+    uint64_t hash = table->hash(key, strlen(key), table->seed);
+    ht_shard_stripe_t *stripe = ht_shard_stripe(table, hash);
+    pthread_rwlock_wrlock(&stripe->lock);
+    ht_dyn_delete_hashed(&stripe->table, key, hash);
+    pthread_rwlock_unlock(&stripe->lock);
+}
+
+/**
+ * @brief Deletes all items from the table.
+ *
+ * @details Empties the stripes one after another, each under its write lock. Items
+ *          inserted concurrently into an already emptied stripe stay in the table.
+ *
+ * @param table A pointer to the table.
+ *
+ * @pre 'table' must be initialized.
+ *
+ * @return This function does not return a value.
+ */
+void ht_shard_delete_all(ht_shard_table_t *table) {
+
+    // Check for NULL
+    if (table == NULL || table->stripes == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < table->stripe_count; i++) {
+        pthread_rwlock_wrlock(&table->stripes[i].lock);
+        ht_dyn_delete_all(&table->stripes[i].table);
+        pthread_rwlock_unlock(&table->stripes[i].lock);
+    }
+}
+
+/**
+ * @brief Releases the table together with all its items.
+ *
+ * @param table A pointer to the table.
+ *
+ * @pre No other thread may use the table during or after the call.
+ *
+ * @post The table holds no memory and must be initialized again before further use.
+ *
+ * @return This function does not return a value.
+ */
+void ht_shard_free(ht_shard_table_t *table) {
+
+    // Check for NULL
+    if (table == NULL || table->stripes == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < table->stripe_count; i++) {
+        ht_dyn_free(&table->stripes[i].table);
+        pthread_rwlock_destroy(&table->stripes[i].lock);
+    }
+    free(table->stripes);
+    table->stripes = NULL;
+    table->stripe_count = 0;
+}
+
+/**
+ * @brief Returns the number of items in the table.
+ *
+ * @details Sums the item counts of the stripes, reading each under its lock. While
+ *          other threads modify the table, the result is a snapshot that may be stale.
+ *
+ * @param table A pointer to the table.
+ *
+ * @return The number of items, or 0 for a NULL or released table.
+ */
+int ht_shard_count(ht_shard_table_t *table) {
+
+    // Check for NULL
+    if (table == NULL || table->stripes == NULL) {
+        return 0;
+    }
+
+    int count = 0;
+    for (int i = 0; i < table->stripe_count; i++) {
+        pthread_rwlock_rdlock(&table->stripes[i].lock);
+        count += table->stripes[i].table.count;
+        pthread_rwlock_unlock(&table->stripes[i].lock);
+    }
+    return count;
+}
+
+/* End of hashtable_shard.c */
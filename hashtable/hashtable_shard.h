@@ -0,0 +1,51 @@
+/*
+ * Header file for the thread-safe sharded hash table. Keys are spread over
+ * a fixed number of stripes by their hash; every stripe is a growable table
+ * guarded by its own reader-writer lock, so threads working on different
+ * stripes never wait for each other.
+ * Translation units including this header must be compiled with -pthread
+ * and define _POSIX_C_SOURCE (200809L) before including any system header.
+ */
+
+#ifndef IAL_HASHTABLE_SHARD_H
+#define IAL_HASHTABLE_SHARD_H
+
+#include "hashtable_dyn.h"
+#include <pthread.h>
+#include <stdbool.h>
+
+// Stripe count used when ht_shard_init is given a non-positive count
+#define HT_SHARD_DEFAULT_STRIPES 16
+
+// Hash function selecting the stripe; its upper bits must be well mixed
+#define HT_SHARD_HASH ht_hash_xxh64
+
+// Assumed cache line size, stripes are aligned to it to avoid false sharing
+#define HT_SHARD_CACHE_LINE 64
+
+// Stripe
+typedef struct ht_shard_stripe {
+  _Alignas(HT_SHARD_CACHE_LINE) pthread_rwlock_t lock; // guards 'table'
+  ht_dyn_table_t table; // items whose hash selects this stripe
+} ht_shard_stripe_t;
+
+// Sharded table
+typedef struct ht_shard_table {
+  ht_shard_stripe_t *stripes; // array of 'stripe_count' stripes
+  int stripe_count;           // number of stripes, fixed after init
+  ht_hash_fn_t hash;          // hash function selecting the stripe
+  uint64_t seed[2];           // seed passed to the hash function
+} ht_shard_table_t;
+
+bool ht_shard_init(ht_shard_table_t *table, int stripe_count, int size);
+bool ht_shard_contains(ht_shard_table_t *table, char *key);
+void ht_shard_insert(ht_shard_table_t *table, char *key, float value);
+bool ht_shard_get(ht_shard_table_t *table, char *key, float *value);
+void ht_shard_delete(ht_shard_table_t *table, char *key);
+void ht_shard_delete_all(ht_shard_table_t *table);
+void ht_shard_free(ht_shard_table_t *table);
+int ht_shard_count(ht_shard_table_t *table);
+
+#endif
+
+/* End of hashtable_shard.h */
@@ -0,0 +1,515 @@
+/**
+ * @file hashtable_swiss.c
+ * @brief Open-addressing hashtable with SIMD group probing (Swiss table).
+ * @details Implements a hashtable whose slots are split into groups of
+ *          HT_SWISS_GROUP_SIZE (16). Besides the flat key and value arrays, every slot
+ *          has a one-byte control entry: HT_SWISS_EMPTY, HT_SWISS_DELETED (a tombstone),
+ *          or, for a full slot, the low 7 bits of the key's hash (H2). The remaining
+ *          bits (H1) select the first group to probe; further groups are visited with
+ *          triangular steps, which reach every group of a power-of-two table.
+ *
+ *          A lookup loads the 16 control bytes of a group and compares them with H2 in
+ *          a single SSE2 instruction. Only the slots whose fragment matches (on average
+ *          1 in 128 of the non-matching ones) have their keys compared, and the search
+ *          ends at the first group containing an empty slot. Negative lookups therefore
+ *          usually touch one control-byte cache line and no keys at all. Without SSE2
+ *          (or with HT_SWISS_NO_SIMD defined), the same group masks are computed by a
+ *          portable byte loop.
+ *
+ *          Key functions implemented:
+ *          - ht_swiss_init: Allocates the control, key and value arrays.
+ *          - ht_swiss_search: Finds the slot holding a key.
+ *          - ht_swiss_insert: Inserts a new item or updates an existing one.
+ *          - ht_swiss_get: Retrieves an item's value from the table.
+ *          - ht_swiss_delete: Removes an item from the table.
+ *          - ht_swiss_delete_all: Deletes all items from the table.
+ *          - ht_swiss_free: Deletes all items and releases the arrays.
+ *          - ht_swiss_resize: Rehashes the table into new arrays.
+ *
+ * @code
+ * ht_swiss_table_t my_table;
+ * ht_swiss_init(&my_table, 0);
+ * ht_swiss_insert(&my_table, "key1", 1.0f);
+ * float *value = ht_swiss_get(&my_table, "key1");
+ * if (value) {
+ *     printf("Found value: %f\n", *value);
+ * }
+ * ht_swiss_free(&my_table);
+ * @endcode
+ *
+ * @see hashtable_swiss.h for type definitions and constants.
+ * @see hashtable_oa.c for the Robin Hood open-addressing table.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project02-2021 for the project repository.
+ */
+
+#include "hashtable_swiss.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__) && !defined(HT_SWISS_NO_SIMD)
+#include <emmintrin.h>
+#define HT_SWISS_SSE2
+#endif
+
+// Defined in hashtable.c, string.h does not declare it in strict C11 mode
+char *strdup(const char *s);
+
+/**
+ * @brief Returns a bit mask of the control bytes of a group equal to 'value'.
+ *
+ * @param group Pointer to the first of HT_SWISS_GROUP_SIZE control bytes.
+ * @param value The control byte to look for.
+ *
+ * @return Bit i is set when group[i] == value.
+ */
+static inline unsigned ht_swiss_match(const int8_t *group, int8_t value) {
+#ifdef HT_SWISS_SSE2
+    __m128i ctrl = _mm_loadu_si128((const __m128i *) group);
+    return (unsigned) _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(value)));
+#else
+    unsigned mask = 0;
+    for (int i = 0; i < HT_SWISS_GROUP_SIZE; i++) {
+        mask |= (unsigned) (group[i] == value) << i;
+    }
+    return mask;
+#endif
+}
+
+/**
+ * @brief Returns a bit mask of the empty or deleted slots of a group.
+ *
+ * @details Both special control values are negative while full slots are not, so the
+ *          mask consists of the sign bits of the control bytes.
+ *
+ * @param group Pointer to the first of HT_SWISS_GROUP_SIZE control bytes.
+ *
+ * @return Bit i is set when slot i of the group can take a new item.
+ */
+static inline unsigned ht_swiss_match_free(const int8_t *group) {
+#ifdef HT_SWISS_SSE2
+    return (unsigned) _mm_movemask_epi8(_mm_loadu_si128((const __m128i *) group));
+#else
+    unsigned mask = 0;
+    for (int i = 0; i < HT_SWISS_GROUP_SIZE; i++) {
+        mask |= (unsigned) (group[i] < 0) << i;
+    }
+    return mask;
+#endif
+}
+
+/**
+ * @brief Returns the index of the lowest set bit of a non-zero mask.
+ */
+static inline int ht_swiss_lowest_bit(unsigned mask) {
+#if defined(__GNUC__)
+    return __builtin_ctz(mask);
+#else
+    int index = 0;
+    while ((mask & 1) == 0) {
+        mask >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+/**
+ * @brief Allocates the arrays for 'size' slots and marks all of them empty.
+ *
+ * @retval true The arrays were allocated.
+ * @retval false Allocation failed; 'table' is left unchanged.
+ */
+static bool ht_swiss_alloc(ht_swiss_table_t *table, int size) {
+    int8_t *ctrl = malloc(size);
+    char **keys = malloc(size * sizeof(char *));
+    float *values = malloc(size * sizeof(float));
+    if (ctrl == NULL || keys == NULL || values == NULL) {
+        free(ctrl);
+        free(keys);
+        free(values);
+        return false;
+    }
+    memset(ctrl, HT_SWISS_EMPTY, size);
+    table->ctrl = ctrl;
+    table->keys = keys;
+    table->values = values;
+    table->size = size;
+    table->deleted = 0;
+    return true;
+}
+
+/**
+ * @brief Stores an item known not to be in the table into the first free slot.
+ *
+ * @details Walks the probe sequence of the hash and takes the first empty or deleted
+ *          slot. A reused tombstone is subtracted from the tombstone count.
+ *
+ * @param table A pointer to the table.
+ * @param key The key, whose ownership passes to the table.
+ * @param value The value of the item.
+ * @param hash The full hash of the key.
+ *
+ * @retval true The item was stored.
+ * @retval false There is no free slot in the table.
+ */
+static bool ht_swiss_place(ht_swiss_table_t *table, char *key, float value, uint64_t hash) {
+    int groups = table->size / HT_SWISS_GROUP_SIZE;
+    int group = (int) ((hash >> 7) & (uint64_t) (groups - 1));
+
+    for (int step = 1; step <= groups; step++) {
+        unsigned freeSlots = ht_swiss_match_free(table->ctrl + group * HT_SWISS_GROUP_SIZE);
+        if (freeSlots != 0) {
+            int slot = group * HT_SWISS_GROUP_SIZE + ht_swiss_lowest_bit(freeSlots);
+            if (table->ctrl[slot] == HT_SWISS_DELETED) {
+                table->deleted--;
+            }
+            table->ctrl[slot] = (int8_t) (hash & 0x7f);
+            table->keys[slot] = key;
+            table->values[slot] = value;
+            return true;
+        }
+        group = (group + step) & (groups - 1);
+    }
+    return false;
+}
+
+/**
+ * @brief Initializes a Swiss hashtable.
+ *
+ * @details Allocates the arrays with the smallest power-of-two multiple of the group
+ *          size that is at least 'size' (HT_SWISS_DEFAULT_SIZE when 'size' is not
+ *          positive) and marks all slots empty. Keys are hashed by HT_SWISS_DEFAULT_HASH
+ *          with an all-zero seed; both may be changed while the table is empty.
+ *
+ * @param table A pointer to the table to be initialized.
+ * @param size The requested initial number of slots.
+ *
+ * @pre 'table' must not reference an initialized table, otherwise its memory is leaked.
+ *
+ * @post On success, the table is empty and ready for use.
+ *
+ * @code
+ * ht_swiss_table_t my_table;
+ * if (!ht_swiss_init(&my_table, 1024)) {
+ *     // handle allocation failure
+ * }
+ * @endcode
+ *
+ * @warning The table must be released with `ht_swiss_free` to avoid memory leaks.
+ *
+ * @retval true The table was initialized.
+ * @retval false 'table' is NULL or the arrays could not be allocated.
+ */
+bool ht_swiss_init(ht_swiss_table_t *table, int size) {
+
+    // Check for NULL
+    if (table == NULL) {
+        return false;
+    }
+
+    int slots = HT_SWISS_GROUP_SIZE;
+    while (slots < (size > 0 ? size : HT_SWISS_DEFAULT_SIZE)) {
+        slots *= 2;
+    }
+    table->ctrl = NULL;
+    table->keys = NULL;
+    table->values = NULL;
+    table->size = 0;
+    table->count = 0;
+    table->deleted = 0;
+    table->max_load = HT_SWISS_MAX_LOAD;
+    table->hash = HT_SWISS_DEFAULT_HASH;
+    table->seed[0] = 0;
+    table->seed[1] = 0;
+    return ht_swiss_alloc(table, slots);
+}
+
+/**
+ * @brief Searches for the slot holding the specified key.
+ *
+ * @details Visits the groups of the key's probe sequence. In each group, the keys are
+ *          compared only in the slots whose control byte equals the key's 7-bit hash
+ *          fragment. The search ends with a miss at the first group that has an empty
+ *          slot, since an insertion of the key would have stopped there.
+ *
+ * @param table A pointer to the table.
+ * @param key The key to search for.
+ *
+ * @pre 'table' must be initialized. 'key' must be a null-terminated string.
+ *
+ * @code
+ * int slot = ht_swiss_search(&my_table, "my_key");
+ * if (slot >= 0) {
+ *     printf("%s -> %f\n", my_table.keys[slot], my_table.values[slot]);
+ * }
+ * @endcode
+ *
+ * @warning The returned index is only valid until the table is rehashed.
+ *
+ * @retval -1 The key was not found or 'table' is NULL.
+ * @return The index of the slot holding the key.
+ */
+int ht_swiss_search(ht_swiss_table_t *table, char *key) {
+
+    // Check for NULL
+    if (table == NULL || table->ctrl == NULL) {
+        return -1;
+    }
+
+    uint64_t hash = table->hash(key, strlen(key), table->seed);
+    int8_t fragment = (int8_t) (hash & 0x7f);
+    int groups = table->size / HT_SWISS_GROUP_SIZE;
+    int group = (int) ((hash >> 7) & (uint64_t) (groups - 1));
+
+    for (int step = 1; step <= groups; step++) {
+        const int8_t *ctrl = table->ctrl + group * HT_SWISS_GROUP_SIZE;
+        // Compare the keys of the candidates only
+        for (unsigned match = ht_swiss_match(ctrl, fragment); match != 0; match &= match - 1) {
+            int slot = group * HT_SWISS_GROUP_SIZE + ht_swiss_lowest_bit(match);
+            if (strcmp(table->keys[slot], key) == 0) {
+                return slot;
+            }
+        }
+        // The key would have been placed into this group
+        if (ht_swiss_match(ctrl, HT_SWISS_EMPTY) != 0) {
+            return -1;
+        }
+        group = (group + step) & (groups - 1);
+    }
+    return -1;
+}
+
+/**
+ * @brief Rehashes all items into new arrays.
+ *
+ * @details Allocates arrays with the smallest power-of-two multiple of the group size
+ *          of slots that is at least 'size' and larger than the number of items, and
+ *          re-places every item. Tombstones are dropped in the process.
+ *
+ * @param table A pointer to the table.
+ * @param size The requested number of slots.
+ *
+ * @pre 'table' must be initialized.
+ *
+ * @post On success, the table has the new number of slots, no tombstones, and contains
+ *       the same items. On failure, the table is left unchanged.
+ *
+ * @retval true The table was rehashed.
+ * @retval false 'table' is NULL or the new arrays could not be allocated.
+ */
+bool ht_swiss_resize(ht_swiss_table_t *table, int size) {
+
+    // Check for NULL
+    if (table == NULL || table->ctrl == NULL) {
+        return false;
+    }
+
+    int slots = HT_SWISS_GROUP_SIZE;
+    while (slots < size || slots <= table->count) {
+        slots *= 2;
+    }
+
+    ht_swiss_table_t old = *table;
+    if (!ht_swiss_alloc(table, slots)) {
+        return false;
+    }
+    for (int i = 0; i < old.size; i++) {
+        if (old.ctrl[i] >= 0) {
+            char *key = old.keys[i];
+            ht_swiss_place(table, key, old.values[i], table->hash(key, strlen(key), table->seed));
+        }
+    }
+    free(old.ctrl);
+    free(old.keys);
+    free(old.values);
+    return true;
+}
+
+/**
+ * @brief Inserts or updates an item in the table.
+ *
+ * @details If the key is already stored, its value is updated. Otherwise, when the new
+ *          item would push the used slots (full slots and tombstones) over the load
+ *          factor limit, the table is rehashed first: into the same size when at least
+ *          half of the used slots are tombstones, into twice the size otherwise.
+ *          The item then takes the first free slot of its probe sequence.
+ *
+ * @param table A pointer to the table.
+ * @param key The key associated with the item.
+ * @param value The value to be inserted or updated.
+ *
+ * @pre 'table' must be initialized. 'key' must be a null-terminated string.
+ *
+ * @code
+ * ht_swiss_insert(&my_table, "key1", 1.0f);
+ * @endcode
+ *
+ * @warning When growth is disabled (or fails) and no slot is free, the insertion is
+ *          not completed.
+ *
+ * @return This function does not return a value.
+ */
+void ht_swiss_insert(ht_swiss_table_t *table, char *key, float value) {
+
+    // Check for NULL
+    if (table == NULL || table->ctrl == NULL) {
+        return;
+    }
+
+    // Update the item if it is already in the table
+    int slot = ht_swiss_search(table, key);
+    if (slot >= 0) {
+        table->values[slot] = value;
+        return;
+    }
+
+    // Rehash before the load factor limit is exceeded
+    if (table->max_load > 0 && table->count + table->deleted + 1 > table->max_load * table->size) {
+        bool mostlyTombstones = table->deleted >= table->count;
+        ht_swiss_resize(table, mostlyTombstones ? table->size : 2 * table->size);
+    }
+
+    char *newKey = strdup(key);
+    if (newKey == NULL) {
+        return;
+    }
+    if (!ht_swiss_place(table, newKey, value, table->hash(key, strlen(key), table->seed))) {
+        free(newKey);
+        return;
+    }
+    table->count++;
+}
+
+/**
+ * @brief Retrieves the value associated with a key from the table.
+ *
+ * @param table A pointer to the table.
+ * @param key The key string associated with the desired value.
+ *
+ * @pre 'table' must be initialized. 'key' must be a null-terminated string.
+ *
+ * @code
+ * float *value = ht_swiss_get(&my_table, "my_key");
+ * @endcode
+ *
+ * @warning The returned pointer is only valid until the table is rehashed.
+ *
+ * @retval NULL The key was not found or 'table' is NULL.
+ * @retval non-NULL A pointer to the value associated with the key.
+ */
+float *ht_swiss_get(ht_swiss_table_t *table, char *key) {
+    int slot = ht_swiss_search(table, key);
+    return slot >= 0 ? &table->values[slot] : NULL;
+}
+
+/**
+ * @brief Removes an item with the specified key from the table.
+ *
+ * @details Frees the key and releases the slot. If the slot's group still has an empty
+ *          slot, no probe sequence can have continued past this group, so the slot is
+ *          marked empty; otherwise it becomes a tombstone that lookups step over.
+ *
+ * @param table A pointer to the table.
+ * @param key The key of the item to delete.
+ *
+ * @pre 'table' must be initialized. 'key' must be a null-terminated string.
+ *
+ * @post The item is no longer in the table and its key is freed.
+ *
+ * @code
+ * ht_swiss_delete(&my_table, "my_key");
+ * @endcode
+ *
+ * @return This function does not return a value.
+ */
+void ht_swiss_delete(ht_swiss_table_t *table, char *key) {
+    int slot = ht_swiss_search(table, key);
+    if (slot < 0) {
+        return;
+    }
+
+    const int8_t *group = table->ctrl + (slot / HT_SWISS_GROUP_SIZE) * HT_SWISS_GROUP_SIZE;
+    free(table->keys[slot]);
+    if (ht_swiss_match(group, HT_SWISS_EMPTY) != 0) {
+        table->ctrl[slot] = HT_SWISS_EMPTY;
+    }
+    else {
+        table->ctrl[slot] = HT_SWISS_DELETED;
+        table->deleted++;
+    }
+    table->count--;
+}
+
+/**
+ * @brief Deletes all items from the table.
+ *
+ * @details Frees every key and marks all slots empty, dropping the tombstones as well.
+ *          The arrays keep their size.
+ *
+ * @param table A pointer to the table.
+ *
+ * @pre 'table' must be initialized.
+ *
+ * @post The table is empty.
+ *
+ * @return This function does not return a value.
+ */
+void ht_swiss_delete_all(ht_swiss_table_t *table) {
+
+    // Check for NULL
+    if (table == NULL || table->ctrl == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < table->size; i++) {
+        if (table->ctrl[i] >= 0) {
+            free(table->keys[i]);
+        }
+    }
+    memset(table->ctrl, HT_SWISS_EMPTY, table->size);
+    table->count = 0;
+    table->deleted = 0;
+}
+
+/**
+ * @brief Deletes all items and releases the arrays of the table.
+ *
+ * @param table A pointer to the table.
+ *
+ * @post The table holds no memory and must be initialized again before further use.
+ *
+ * @return This function does not return a value.
+ */
+void ht_swiss_free(ht_swiss_table_t *table) {
+
+    // Check for NULL
+    if (table == NULL) {
+        return;
+    }
+
+    ht_swiss_delete_all(table);
+    free(table->ctrl);
+    free(table->keys);
+    free(table->values);
+    table->ctrl = NULL;
+    table->keys = NULL;
+    table->values = NULL;
+    table->size = 0;
+}
+
+/**
+ * @brief Returns the current load factor (full slots per slot) of the table.
+ *
+ * @param table A pointer to the table.
+ *
+ * @return The load factor, or 0 for a NULL or released table.
+ */
+float ht_swiss_load_factor(ht_swiss_table_t *table) {
+    if (table == NULL || table->size == 0) {
+        return 0;
+    }
+    return (float) table->count / table->size;
+}
+
+/* End of hashtable_swiss.c */
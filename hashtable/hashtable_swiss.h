@@ -0,0 +1,56 @@
+/*
+ * Header file for the open-addressing hash table with group probing
+ * (Swiss table). A control byte per slot holds 7 bits of the key's hash,
+ * and lookups test 16 control bytes at once with SSE2 when available.
+ * Define HT_SWISS_NO_SIMD to force the portable scalar group matching.
+ */
+
+#ifndef IAL_HASHTABLE_SWISS_H
+#define IAL_HASHTABLE_SWISS_H
+
+#include "ht_hash.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Number of slots probed together
+#define HT_SWISS_GROUP_SIZE 16
+
+// Control byte values; full slots hold the 7-bit hash fragment (0..127)
+#define HT_SWISS_EMPTY ((int8_t) -128)
+#define HT_SWISS_DELETED ((int8_t) -2)
+
+// Slot count used when ht_swiss_init is given a non-positive size
+#define HT_SWISS_DEFAULT_SIZE 16
+
+// Load factor (used slots per slot, tombstones included) that triggers a rehash
+#define HT_SWISS_MAX_LOAD 0.875f
+
+// Hash function used when no other is selected
+#define HT_SWISS_DEFAULT_HASH ht_hash_xxh64
+
+// Swiss table
+typedef struct ht_swiss_table {
+  int8_t *ctrl;      // control byte of each slot
+  char **keys;       // key of each slot
+  float *values;     // value of each slot
+  int size;          // number of slots, a power-of-two multiple of the group size
+  int count;         // number of full slots
+  int deleted;       // number of tombstones
+  float max_load;    // load factor limit, growth is disabled when <= 0
+  ht_hash_fn_t hash; // hash function of the keys
+  uint64_t seed[2];  // seed passed to the hash function
+} ht_swiss_table_t;
+
+bool ht_swiss_init(ht_swiss_table_t *table, int size);
+int ht_swiss_search(ht_swiss_table_t *table, char *key);
+void ht_swiss_insert(ht_swiss_table_t *table, char *key, float value);
+float *ht_swiss_get(ht_swiss_table_t *table, char *key);
+void ht_swiss_delete(ht_swiss_table_t *table, char *key);
+void ht_swiss_delete_all(ht_swiss_table_t *table);
+void ht_swiss_free(ht_swiss_table_t *table);
+bool ht_swiss_resize(ht_swiss_table_t *table, int size);
+float ht_swiss_load_factor(ht_swiss_table_t *table);
+
+#endif
+
+/* End of hashtable_swiss.h */
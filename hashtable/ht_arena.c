@@ -0,0 +1,193 @@
+/**
+ * @file ht_arena.c
+ * @brief Slab (arena) allocator for hashtable items and keys.
+ * @details Hands out memory by bumping an offset inside large slabs obtained from
+ *          `malloc`. An allocation therefore costs a few instructions, consecutive
+ *          allocations of the same size lie next to each other in memory, and there
+ *          is no per-allocation header. Individual allocations cannot be freed; instead
+ *          the whole arena is rewound (`ht_arena_reset`) or released (`ht_arena_free`)
+ *          in O(number of slabs).
+ *
+ *          Key functions implemented:
+ *          - ht_arena_init: Initializes an empty arena.
+ *          - ht_arena_alloc: Allocates a block from the current slab.
+ *          - ht_arena_strdup: Copies a string into the arena.
+ *          - ht_arena_reset: Releases all slabs but one and rewinds it.
+ *          - ht_arena_free: Releases all slabs.
+ *
+ * @code
+ * ht_arena_t arena;
+ * ht_arena_init(&arena, 0);
+ * ht_item_t *item = ht_arena_alloc(&arena, sizeof(ht_item_t));
+ * item->key = ht_arena_strdup(&arena, "key1");
+ * ht_arena_free(&arena); // releases the item and the key
+ * @endcode
+ *
+ * @see ht_arena.h for type definitions and constants.
+ * @see hashtable_dyn.c for the table using the arena.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project02-2021 for the project repository.
+ */
+
+#include "ht_arena.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Initializes an empty arena.
+ *
+ * @details No memory is allocated until the first `ht_arena_alloc`.
+ *
+ * @param arena A pointer to the arena to be initialized.
+ * @param slab_size Capacity of a regular slab in bytes, HT_ARENA_SLAB_SIZE when 0.
+ *
+ * @return This function does not return a value.
+ */
+void ht_arena_init(ht_arena_t *arena, size_t slab_size) {
+
+    // Check for NULL
+    if (arena == NULL) {
+        return;
+    }
+
+    arena->slabs = NULL;
+    arena->slab_size = slab_size > 0 ? slab_size : HT_ARENA_SLAB_SIZE;
+    arena->slab_count = 0;
+}
+
+/**
+ * @brief Allocates a block of 'size' bytes from the arena.
+ *
+ * @details Rounds the size up to the alignment of `max_align_t` and takes the block from
+ *          the current slab. When the slab is full, a new one is allocated and becomes the
+ *          current slab; the rest of the old slab stays unused. Requests larger than a
+ *          regular slab get a dedicated slab of their own size.
+ *
+ * @param arena A pointer to an initialized arena.
+ * @param size The number of bytes to allocate.
+ *
+ * @pre 'arena' must be initialized.
+ *
+ * @post The block stays valid until the arena is reset or freed.
+ *
+ * @code
+ * ht_item_t *item = ht_arena_alloc(&arena, sizeof(ht_item_t));
+ * @endcode
+ *
+ * @warning The block must not be passed to `free`.
+ *
+ * @retval NULL 'arena' is NULL or a new slab could not be allocated.
+ * @retval non-NULL A pointer to the block, suitably aligned for any type.
+ */
+void *ht_arena_alloc(ht_arena_t *arena, size_t size) {
+
+    // Check for NULL
+    if (arena == NULL) {
+        return NULL;
+    }
+
+    const size_t align = _Alignof(max_align_t);
+    size = (size + align - 1) & ~(align - 1);
+
+    ht_arena_slab_t *slab = arena->slabs;
+    if (slab == NULL || slab->capacity - slab->used < size) {
+        size_t capacity = size > arena->slab_size ? size : arena->slab_size;
+        ht_arena_slab_t *newSlab = malloc(sizeof(ht_arena_slab_t) + capacity);
+        if (newSlab == NULL) {
+            return NULL;
+        }
+        newSlab->used = 0;
+        newSlab->capacity = capacity;
+        newSlab->next = slab;
+        arena->slabs = newSlab;
+        arena->slab_count++;
+        slab = newSlab;
+    }
+
+    void *block = (unsigned char *) slab->data + slab->used;
+    slab->used += size;
+    return block;
+}
+
+/**
+ * @brief Copies a string into the arena.
+ *
+ * @details Equivalent of `strdup` whose result is owned by the arena.
+ *
+ * @param arena A pointer to an initialized arena.
+ * @param s The string to be duplicated.
+ *
+ * @pre 's' must be a valid null-terminated string.
+ *
+ * @retval NULL Allocation failed.
+ * @retval non-NULL Pointer to the copy of the string.
+ */
+char *ht_arena_strdup(ht_arena_t *arena, const char *s) {
+    size_t length = strlen(s) + 1;
+    char *duplicate = ht_arena_alloc(arena, length);
+    if (duplicate == NULL) {
+        return NULL;
+    }
+    memcpy(duplicate, s, length);
+    return duplicate;
+}
+
+/**
+ * @brief Invalidates all allocations of the arena, keeping one slab for reuse.
+ *
+ * @details Releases every slab except the current one, which is rewound, so that
+ *          refilling the arena does not start with a `malloc`. Runs in O(number of slabs).
+ *
+ * @param arena A pointer to an initialized arena.
+ *
+ * @post All blocks handed out by the arena are invalid.
+ *
+ * @return This function does not return a value.
+ */
+void ht_arena_reset(ht_arena_t *arena) {
+
+    // Check for NULL
+    if (arena == NULL || arena->slabs == NULL) {
+        return;
+    }
+
+    ht_arena_slab_t *slab = arena->slabs->next;
+    while (slab != NULL) {
+        ht_arena_slab_t *nextSlab = slab->next;
+        free(slab);
+        slab = nextSlab;
+    }
+    arena->slabs->next = NULL;
+    arena->slabs->used = 0;
+    arena->slab_count = 1;
+}
+
+/**
+ * @brief Releases all slabs of the arena.
+ *
+ * @details Runs in O(number of slabs), regardless of the number of allocations.
+ *
+ * @param arena A pointer to an initialized arena.
+ *
+ * @post All blocks handed out by the arena are invalid and the arena is empty.
+ *
+ * @return This function does not return a value.
+ */
+void ht_arena_free(ht_arena_t *arena) {
+
+    // Check for NULL
+    if (arena == NULL) {
+        return;
+    }
+
+    ht_arena_slab_t *slab = arena->slabs;
+    while (slab != NULL) {
+        ht_arena_slab_t *nextSlab = slab->next;
+        free(slab);
+        slab = nextSlab;
+    }
+    arena->slabs = NULL;
+    arena->slab_count = 0;
+}
+
+/* End of ht_arena.c */
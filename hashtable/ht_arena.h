@@ -0,0 +1,38 @@
+/*
+ * Header file for the slab (arena) allocator used by the hash tables.
+ * Allocations are carved sequentially out of large slabs and are never
+ * freed individually; the whole arena is released or rewound at once.
+ */
+
+#ifndef IAL_HT_ARENA_H
+#define IAL_HT_ARENA_H
+
+#include <stddef.h>
+
+// Default slab size in bytes
+#define HT_ARENA_SLAB_SIZE (64 * 1024)
+
+// Slab, the allocations follow the header
+typedef struct ht_arena_slab {
+  struct ht_arena_slab *next; // previously filled slab
+  size_t used;                // bytes handed out from 'data'
+  size_t capacity;            // size of 'data' in bytes
+  max_align_t data[];         // storage, aligned for any type
+} ht_arena_slab_t;
+
+// Arena
+typedef struct ht_arena {
+  ht_arena_slab_t *slabs; // slab being filled, followed by the full ones
+  size_t slab_size;       // capacity of a regular slab
+  int slab_count;         // number of allocated slabs
+} ht_arena_t;
+
+void ht_arena_init(ht_arena_t *arena, size_t slab_size);
+void *ht_arena_alloc(ht_arena_t *arena, size_t size);
+char *ht_arena_strdup(ht_arena_t *arena, const char *s);
+void ht_arena_reset(ht_arena_t *arena);
+void ht_arena_free(ht_arena_t *arena);
+
+#endif
+
+/* End of ht_arena.h */
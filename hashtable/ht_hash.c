@@ -0,0 +1,275 @@
+/**
+ * @file ht_hash.c
+ * @brief String hash functions for the hash tables.
+ * @details Provides a family of interchangeable 64-bit hash functions with a common
+ *          signature (`ht_hash_fn_t`), so that every growable table can pick the one
+ *          that fits its keys:
+ *          - ht_hash_additive: The sum of the character codes used by `get_hash`.
+ *            Kept only as a baseline for the benchmarks; anagrams always collide.
+ *          - ht_hash_fnv1a: 64-bit FNV-1a. Very cheap for short keys.
+ *          - ht_hash_xxh64: XXH64, processing 8 bytes per step with 64-bit
+ *            multiply/rotate mixing and a full avalanche finalizer.
+ *          - ht_hash_siphash: SipHash-2-4 keyed with a secret 128-bit seed. Slower, but
+ *            an attacker who does not know the seed cannot craft colliding keys, so
+ *            it should be used for untrusted input.
+ *
+ *          Multi-byte words are assembled in little-endian order, so the results are
+ *          the same on every platform and match the reference implementations.
+ *
+ * @code
+ * uint64_t seed[2] = {0x0123456789abcdef, 0xfedcba9876543210};
+ * uint64_t hash = ht_hash_siphash("key", 3, seed);
+ * @endcode
+ *
+ * @see ht_hash.h for the function signature.
+ * @see hashtable_dyn.c for the table selecting the function per instance.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project02-2021 for the project repository.
+ */
+
+#include "ht_hash.h"
+
+// XXH64 primes
+#define XXH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define XXH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define XXH_PRIME64_3 0x165667B19E3779F9ULL
+#define XXH_PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define XXH_PRIME64_5 0x27D4EB2F165667C5ULL
+
+const ht_hash_info_t HT_HASH_FUNCTIONS[] = {
+        {"additive", ht_hash_additive},
+        {"fnv1a", ht_hash_fnv1a},
+        {"xxh64", ht_hash_xxh64},
+        {"siphash", ht_hash_siphash},
+        {NULL, NULL}};
+
+/**
+ * @brief Rotates a 64-bit value left by 'bits' (1 to 63) positions.
+ */
+static inline uint64_t ht_rotl64(uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+/**
+ * @brief Reads a little-endian 64-bit word from 'p'.
+ *
+ * @note Compilers turn the byte assembly into a single load on little-endian machines.
+ */
+static inline uint64_t ht_read64(const unsigned char *p) {
+    return (uint64_t) p[0] | (uint64_t) p[1] << 8 | (uint64_t) p[2] << 16 |
+           (uint64_t) p[3] << 24 | (uint64_t) p[4] << 32 | (uint64_t) p[5] << 40 |
+           (uint64_t) p[6] << 48 | (uint64_t) p[7] << 56;
+}
+
+/**
+ * @brief Reads a little-endian 32-bit word from 'p'.
+ */
+static inline uint64_t ht_read32(const unsigned char *p) {
+    return (uint64_t) p[0] | (uint64_t) p[1] << 8 | (uint64_t) p[2] << 16 |
+           (uint64_t) p[3] << 24;
+}
+
+/**
+ * @brief Sums the character codes of the data, like `get_hash` does before reducing.
+ *
+ * @details Provided only as a baseline for comparison. All permutations of the same
+ *          characters produce the same value and the results of short keys span only
+ *          a few hundred values, so it must not be used for real tables.
+ *
+ * @param data The bytes to hash.
+ * @param length The number of bytes.
+ * @param seed Ignored.
+ *
+ * @return The 64-bit hash value.
+ */
+uint64_t ht_hash_additive(const void *data, size_t length, const uint64_t seed[2]) {
+    const unsigned char *p = data;
+    uint64_t result = 1;
+    for (size_t i = 0; i < length; i++) {
+        result += p[i];
+    }
+    return result;
+}
+
+/**
+ * @brief Computes the 64-bit FNV-1a hash of the data.
+ *
+ * @details XORs each byte into the state and multiplies it by the FNV prime. The seed,
+ *          if given, is XORed into the offset basis; a NULL or zero seed yields the
+ *          standard FNV-1a value.
+ *
+ * @param data The bytes to hash.
+ * @param length The number of bytes.
+ * @param seed Optional seed, only seed[0] is used.
+ *
+ * @note Fast for short keys, but processes a single byte per multiplication and is not
+ *       resistant to deliberately crafted collisions.
+ *
+ * @return The 64-bit hash value.
+ */
+uint64_t ht_hash_fnv1a(const void *data, size_t length, const uint64_t seed[2]) {
+    const unsigned char *p = data;
+    uint64_t result = 0xcbf29ce484222325ULL ^ (seed != NULL ? seed[0] : 0);
+    for (size_t i = 0; i < length; i++) {
+        result ^= p[i];
+        result *= 0x100000001b3ULL;
+    }
+    return result;
+}
+
+/**
+ * @brief Mixes one 64-bit lane into an XXH64 accumulator.
+ */
+static inline uint64_t ht_xxh64_round(uint64_t acc, uint64_t input) {
+    acc += input * XXH_PRIME64_2;
+    acc = ht_rotl64(acc, 31);
+    return acc * XXH_PRIME64_1;
+}
+
+/**
+ * @brief Merges an XXH64 accumulator into the final hash value.
+ */
+static inline uint64_t ht_xxh64_merge(uint64_t acc, uint64_t value) {
+    acc ^= ht_xxh64_round(0, value);
+    return acc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+/**
+ * @brief Computes the XXH64 hash of the data.
+ *
+ * @details Inputs of at least 32 bytes are consumed by four independent accumulators,
+ *          8 bytes each per step; the tail is mixed 8, 4 and 1 bytes at a time. The final
+ *          avalanche step makes every input bit affect every output bit with probability
+ *          close to 1/2, so the low bits used for bucket selection are well distributed.
+ *
+ * @param data The bytes to hash.
+ * @param length The number of bytes.
+ * @param seed Optional seed, only seed[0] is used.
+ *
+ * @note The output is identical to the reference XXH64 implementation.
+ *
+ * @return The 64-bit hash value.
+ */
+uint64_t ht_hash_xxh64(const void *data, size_t length, const uint64_t seed[2]) {
+    const unsigned char *p = data;
+    const unsigned char *end = p + length;
+    uint64_t s = seed != NULL ? seed[0] : 0;
+    uint64_t result;
+
+    if (length >= 32) {
+        uint64_t v1 = s + XXH_PRIME64_1 + XXH_PRIME64_2;
+        uint64_t v2 = s + XXH_PRIME64_2;
+        uint64_t v3 = s;
+        uint64_t v4 = s - XXH_PRIME64_1;
+        // Consume 32-byte stripes
+        do {
+            v1 = ht_xxh64_round(v1, ht_read64(p));
+            v2 = ht_xxh64_round(v2, ht_read64(p + 8));
+            v3 = ht_xxh64_round(v3, ht_read64(p + 16));
+            v4 = ht_xxh64_round(v4, ht_read64(p + 24));
+            p += 32;
+        } while (end - p >= 32);
+        result = ht_rotl64(v1, 1) + ht_rotl64(v2, 7) + ht_rotl64(v3, 12) + ht_rotl64(v4, 18);
+        result = ht_xxh64_merge(result, v1);
+        result = ht_xxh64_merge(result, v2);
+        result = ht_xxh64_merge(result, v3);
+        result = ht_xxh64_merge(result, v4);
+    }
+    else {
+        result = s + XXH_PRIME64_5;
+    }
+    result += (uint64_t) length;
+
+    // Mix the tail
+    while (end - p >= 8) {
+        result ^= ht_xxh64_round(0, ht_read64(p));
+        result = ht_rotl64(result, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+        p += 8;
+    }
+    if (end - p >= 4) {
+        result ^= ht_read32(p) * XXH_PRIME64_1;
+        result = ht_rotl64(result, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+        p += 4;
+    }
+    while (p < end) {
+        result ^= *p * XXH_PRIME64_5;
+        result = ht_rotl64(result, 11) * XXH_PRIME64_1;
+        p++;
+    }
+
+    // Avalanche
+    result ^= result >> 33;
+    result *= XXH_PRIME64_2;
+    result ^= result >> 29;
+    result *= XXH_PRIME64_3;
+    result ^= result >> 32;
+    return result;
+}
+
+// One SipRound over the state v0..v3
+#define SIPROUND                                                               \
+    do {                                                                       \
+        v0 += v1; v1 = ht_rotl64(v1, 13); v1 ^= v0; v0 = ht_rotl64(v0, 32);   \
+        v2 += v3; v3 = ht_rotl64(v3, 16); v3 ^= v2;                           \
+        v0 += v3; v3 = ht_rotl64(v3, 21); v3 ^= v0;                           \
+        v2 += v1; v1 = ht_rotl64(v1, 17); v1 ^= v2; v2 = ht_rotl64(v2, 32);   \
+    } while (0)
+
+/**
+ * @brief Computes the SipHash-2-4 keyed hash of the data.
+ *
+ * @details SipHash is a pseudorandom function: without knowing the 128-bit key, the
+ *          output cannot be predicted, so an attacker cannot choose keys that all fall
+ *          into one bucket and degrade the table to a linked list.
+ *
+ * @param data The bytes to hash.
+ * @param length The number of bytes.
+ * @param seed The 128-bit secret key; NULL is treated as an all-zero key.
+ *
+ * @note The output is identical to the reference SipHash-2-4 implementation for the
+ *       key bytes seed[0] (little-endian) followed by seed[1] (little-endian).
+ *
+ * @warning The seed must be kept secret and should be chosen randomly per process,
+ *          otherwise the collision resistance is lost.
+ *
+ * @return The 64-bit hash value.
+ */
+uint64_t ht_hash_siphash(const void *data, size_t length, const uint64_t seed[2]) {
+    const unsigned char *p = data;
+    const unsigned char *end = p + (length & ~(size_t) 7);
+    uint64_t k0 = seed != NULL ? seed[0] : 0;
+    uint64_t k1 = seed != NULL ? seed[1] : 0;
+    uint64_t v0 = k0 ^ 0x736f6d6570736575ULL;
+    uint64_t v1 = k1 ^ 0x646f72616e646f6dULL;
+    uint64_t v2 = k0 ^ 0x6c7967656e657261ULL;
+    uint64_t v3 = k1 ^ 0x7465646279746573ULL;
+
+    // Compression of the full 8-byte words
+    for (; p != end; p += 8) {
+        uint64_t m = ht_read64(p);
+        v3 ^= m;
+        SIPROUND;
+        SIPROUND;
+        v0 ^= m;
+    }
+
+    // The last word holds the remaining bytes and the length in its top byte
+    uint64_t last = (uint64_t) length << 56;
+    for (size_t i = 0; i < (length & 7); i++) {
+        last |= (uint64_t) p[i] << (8 * i);
+    }
+    v3 ^= last;
+    SIPROUND;
+    SIPROUND;
+    v0 ^= last;
+
+    // Finalization
+    v2 ^= 0xff;
+    SIPROUND;
+    SIPROUND;
+    SIPROUND;
+    SIPROUND;
+    return v0 ^ v1 ^ v2 ^ v3;
+}
+
+/* End of ht_hash.c */
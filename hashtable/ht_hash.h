@@ -0,0 +1,38 @@
+/*
+ * Header file for the string hash functions used by the hash tables.
+ * Every function maps 'length' bytes of 'data' to a 64-bit value; the table
+ * reduces it to a bucket index. The 128-bit seed is only honored by the
+ * functions that support seeding.
+ */
+
+#ifndef IAL_HT_HASH_H
+#define IAL_HT_HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Hash function signature shared by all the functions below
+typedef uint64_t (*ht_hash_fn_t)(const void *data, size_t length,
+                                 const uint64_t seed[2]);
+
+// Named hash function, used by the benchmarks and tests
+typedef struct ht_hash_info {
+  const char *name;    // human readable name
+  ht_hash_fn_t fn;     // the function itself
+} ht_hash_info_t;
+
+uint64_t ht_hash_additive(const void *data, size_t length,
+                          const uint64_t seed[2]);
+uint64_t ht_hash_fnv1a(const void *data, size_t length,
+                       const uint64_t seed[2]);
+uint64_t ht_hash_xxh64(const void *data, size_t length,
+                       const uint64_t seed[2]);
+uint64_t ht_hash_siphash(const void *data, size_t length,
+                         const uint64_t seed[2]);
+
+// All available functions, terminated by an entry with NULL name
+extern const ht_hash_info_t HT_HASH_FUNCTIONS[];
+
+#endif
+
+/* End of ht_hash.h */
@@ -0,0 +1,188 @@
+/**
+ * @file ht_intern.c
+ * @brief String interning pool.
+ * @details The pool is a growable hashtable (see hashtable_dyn.c) whose keys are the unique
+ *          strings handed to `ht_intern`. The first call with a given string stores a copy,
+ *          every later call with an equal string returns a pointer to that same copy. Interned
+ *          strings can therefore be compared with `==` and hashed by their address, which is
+ *          what the interned mode of the growable table (`ht_dyn_init_interned`) does.
+ *
+ *          The pool runs in arena mode and never removes a string, so canonical pointers stay
+ *          valid, and keep their address, until `ht_intern_free`.
+ *
+ *          Key functions implemented:
+ *          - ht_intern_init: Initializes an empty pool.
+ *          - ht_intern: Returns the canonical copy of a string, adding it if needed.
+ *          - ht_intern_find: Returns the canonical copy of a string without adding it.
+ *          - ht_intern_count: Returns the number of unique strings.
+ *          - ht_intern_free: Releases the pool and all canonical copies.
+ *          - ht_intern_default: Returns the process-wide pool.
+ *
+ * @code
+ * char buffer[] = "Bitcoin";
+ * char *a = ht_intern(ht_intern_default(), "Bitcoin");
+ * char *b = ht_intern(ht_intern_default(), buffer);
+ * // a == b
+ * @endcode
+ *
+ * @see ht_intern.h for type definitions.
+ * @see hashtable_dyn.c for the interned mode of the growable table.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project02-2021 for the project repository.
+ */
+
+#include "ht_intern.h"
+#include <stddef.h>
+#include <string.h>
+
+// Process-wide pool returned by ht_intern_default
+static ht_intern_pool_t defaultPool;
+static bool defaultPoolReady = false;
+
+/**
+ * @brief Initializes an empty interning pool.
+ *
+ * @param pool A pointer to the pool to be initialized.
+ *
+ * @pre 'pool' must not reference an initialized pool, otherwise its memory is leaked.
+ *
+ * @warning The pool must be released with `ht_intern_free` to avoid memory leaks.
+ *
+ * @retval true The pool was initialized.
+ * @retval false 'pool' is NULL or memory allocation failed.
+ */
+bool ht_intern_init(ht_intern_pool_t *pool) {
+
+    // Check for NULL
+    if (pool == NULL) {
+        return false;
+    }
+
+    return ht_dyn_init_arena(&pool->strings, 0);
+}
+
+/**
+ * @brief Returns the canonical copy of a string, adding the string to the pool if needed.
+ *
+ * @details Looks the string up by value. When it is not in the pool yet, a copy is
+ *          inserted and becomes the canonical copy returned for all equal strings. The
+ *          lookup and the insertion are a single `ht_dyn_insert_hashed`, which returns the
+ *          existing item or the added one, so the string is hashed once and its synonym
+ *          list is walked once.
+ *
+ * @param pool A pointer to an initialized pool.
+ * @param s The string to intern.
+ *
+ * @pre 's' must be a valid null-terminated string.
+ *
+ * @post The pool contains a string equal to 's'.
+ *
+ * @code
+ * char *key = ht_intern(&pool, read_word(file));
+ * @endcode
+ *
+ * @warning The returned string belongs to the pool and must not be modified or freed.
+ *
+ * @retval NULL 'pool' or 's' is NULL, or memory allocation failed.
+ * @retval non-NULL The canonical copy of 's'.
+ */
+char *ht_intern(ht_intern_pool_t *pool, const char *s) {
+
+    // Check for NULL
+    if (pool == NULL || s == NULL) {
+        return NULL;
+    }
+
+    // The value is unused, only the key matters
+    ht_dyn_table_t *strings = &pool->strings;
+    uint64_t hash = strings->hash(s, strlen(s), strings->seed);
+    ht_item_t *item = ht_dyn_insert_hashed(strings, (char *) s, hash, 0);
+    return item != NULL ? item->key : NULL;
+}
+
+/**
+ * @brief Returns the canonical copy of a string without adding it to the pool.
+ *
+ * @details Useful for lookups: a string that was never interned cannot be a key of an
+ *          interned table, and searching for it must not grow the pool.
+ *
+ * @param pool A pointer to an initialized pool.
+ * @param s The string to look up.
+ *
+ * @pre 's' must be a valid null-terminated string.
+ *
+ * @retval NULL 's' was never interned, or 'pool' or 's' is NULL.
+ * @retval non-NULL The canonical copy of 's'.
+ */
+char *ht_intern_find(ht_intern_pool_t *pool, const char *s) {
+
+    // Check for NULL
+    if (pool == NULL || s == NULL) {
+        return NULL;
+    }
+
+    ht_item_t *item = ht_dyn_search(&pool->strings, (char *) s);
+    return item != NULL ? item->key : NULL;
+}
+
+/**
+ * @brief Returns the number of unique strings in the pool.
+ *
+ * @param pool A pointer to the pool.
+ *
+ * @return The number of strings, or 0 for a NULL pool.
+ */
+int ht_intern_count(ht_intern_pool_t *pool) {
+    return pool != NULL ? pool->strings.count : 0;
+}
+
+/**
+ * @brief Releases the pool together with all canonical copies.
+ *
+ * @param pool A pointer to the pool.
+ *
+ * @post Every pointer returned by the pool is invalid. Tables in interned mode using the
+ *       pool must be released before it.
+ *
+ * @return This function does not return a value.
+ */
+void ht_intern_free(ht_intern_pool_t *pool) {
+
+    // Check for NULL
+    if (pool == NULL) {
+        return;
+    }
+
+    ht_dyn_free(&pool->strings);
+    if (pool == &defaultPool) {
+        defaultPoolReady = false;
+    }
+}
+
+/**
+ * @brief Returns the process-wide interning pool.
+ *
+ * @details The pool is initialized by the first call. It may be released with
+ *          `ht_intern_free`, the next call then initializes it again.
+ *
+ * @code
+ * ht_dyn_table_t my_table;
+ * ht_dyn_init_interned(&my_table, 0, ht_intern_default());
+ * @endcode
+ *
+ * @warning The pool is not protected against concurrent use from several threads.
+ *
+ * @retval NULL The pool could not be initialized.
+ * @retval non-NULL A pointer to the process-wide pool.
+ */
+ht_intern_pool_t *ht_intern_default() {
+    if (!defaultPoolReady) {
+        if (!ht_intern_init(&defaultPool)) {
+            return NULL;
+        }
+        defaultPoolReady = true;
+    }
+    return &defaultPool;
+}
+
+/* End of ht_intern.c */
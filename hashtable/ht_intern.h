@@ -0,0 +1,27 @@
+/*
+ * Header file for the string interning pool. The pool keeps one canonical
+ * copy of every string handed to it, so two interned strings are equal
+ * exactly when their pointers are equal.
+ */
+
+#ifndef IAL_HT_INTERN_H
+#define IAL_HT_INTERN_H
+
+#include "hashtable_dyn.h"
+#include <stdbool.h>
+
+// Interning pool
+typedef struct ht_intern_pool {
+  ht_dyn_table_t strings; // unique strings, item keys are the canonical copies
+} ht_intern_pool_t;
+
+bool ht_intern_init(ht_intern_pool_t *pool);
+char *ht_intern(ht_intern_pool_t *pool, const char *s);
+char *ht_intern_find(ht_intern_pool_t *pool, const char *s);
+int ht_intern_count(ht_intern_pool_t *pool);
+void ht_intern_free(ht_intern_pool_t *pool);
+ht_intern_pool_t *ht_intern_default();
+
+#endif
+
+/* End of ht_intern.h */
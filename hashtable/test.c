@@ -3,16 +3,6 @@
 #include <stdio.h>
 #include <stdlib.h>
 
-#define INSERT_TEST_DATA(TABLE)                                                \
-  ht_insert_many(TABLE, TEST_DATA, sizeof(TEST_DATA) / sizeof(TEST_DATA[0]));
-
-const ht_item_t TEST_DATA[15] = {
-    {"Bitcoin", 53247.71}, {"Ethereum", 3208.67}, {"Binance Coin", 409.15},
-    {"Cardano", 1.82},     {"Tether", 0.86},      {"XRP", 0.93},
-    {"Solana", 134.50},    {"Polkadot", 34.99},   {"Dogecoin", 0.22},
-    {"USD Coin", 0.86},    {"Uniswap", 21.68},    {"Terra", 30.67},
-    {"Litecoin", 156.87},  {"Avalanche", 47.03},  {"Chainlink", 21.90}};
-
 void init_test() {
   printf("Hash Table - testing script\n");
   printf("---------------------------\n");
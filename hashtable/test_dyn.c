@@ -0,0 +1,300 @@
+#include "hashtable_dyn.h"
+#include "ht_intern.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_TABLE_SETUP                                                       \
+  ht_dyn_table_t test_table;                                                   \
+  ht_dyn_init(&test_table, 0);
+
+#define TEST_TABLE_TEARDOWN                                                    \
+  ht_dyn_print_table(&test_table);                                             \
+  ht_dyn_free(&test_table);
+
+#define TEST_INSERT ht_dyn_insert
+
+#include "test_util.h"
+
+void ht_dyn_print_table(ht_dyn_table_t *table) {
+  int max_count = 0;
+  int sum_count = 0;
+
+  printf("------------HASH TABLE--------------\n");
+  bool print = table->size <= TEST_PRINT_LIMIT;
+  for (int i = 0; i < table->size; i++) {
+    if (print) {
+      printf("%i: ", i);
+    }
+    int count = ht_print_chain(table->items[i], print);
+    if (print) {
+      printf("\n");
+    }
+    if (count > max_count) {
+      max_count = count;
+    }
+    sum_count += count;
+  }
+
+  if (table->old_items != NULL) {
+    printf("------------------------------------\n");
+    printf("Migrating: %i of %i old buckets done\n", table->migrate_index,
+           table->old_size);
+    for (int i = table->migrate_index; i < table->old_size; i++) {
+      for (ht_item_t *item = table->old_items[i]; item != NULL;
+           item = item->next) {
+        if (table->old_size <= TEST_PRINT_LIMIT) {
+          printf("%i: (%s,%.2f)\n", i, item->key, item->value);
+        }
+        sum_count++;
+      }
+    }
+  }
+
+  ht_print_table_size(table->size, sum_count, table->count, true);
+  printf("Load factor: %.2f\n", ht_dyn_load_factor(table));
+  printf("Maximum hash collisions: %i\n", max_count == 0 ? 0 : max_count - 1);
+  printf("------------------------------------\n");
+}
+
+void init_test() {
+  printf("Growable Hash Table - testing script\n");
+  printf("------------------------------------\n");
+  printf("\n");
+}
+
+TEST(test_table_init, "Initialize the table")
+ENDTEST
+
+TEST(test_search_nonexist, "Search for a non-existing item")
+ht_print_item(ht_dyn_search(&test_table, "Ethereum"));
+ENDTEST
+
+TEST(test_insert_simple, "Insert a new item")
+ht_dyn_insert(&test_table, "Ethereum", 3208.67);
+ht_print_item(ht_dyn_search(&test_table, "Ethereum"));
+ENDTEST
+
+TEST(test_insert_many, "Insert many new items (table grows)")
+INSERT_TEST_DATA(&test_table)
+ENDTEST
+
+TEST(test_insert_update, "Update an item")
+INSERT_TEST_DATA(&test_table)
+ht_dyn_insert(&test_table, "Ethereum", 12.34);
+ht_print_item_value(ht_dyn_get(&test_table, "Ethereum"));
+ENDTEST
+
+TEST(test_get_nonexist, "Get a non-existing item's value")
+INSERT_TEST_DATA(&test_table)
+ht_print_item_value(ht_dyn_get(&test_table, "Monero"));
+ENDTEST
+
+TEST(test_delete, "Delete an item")
+INSERT_TEST_DATA(&test_table)
+ht_dyn_delete(&test_table, "Terra");
+ht_print_item(ht_dyn_search(&test_table, "Terra"));
+ENDTEST
+
+TEST(test_delete_all, "Delete all the items")
+INSERT_TEST_DATA(&test_table)
+ht_dyn_delete_all(&test_table);
+ENDTEST
+
+TEST(test_resize, "Resize the table, items are preserved")
+INSERT_TEST_DATA(&test_table)
+ht_dyn_resize(&test_table, 5);
+ht_print_item_value(ht_dyn_get(&test_table, "Chainlink"));
+ENDTEST
+
+TEST(test_set_hash, "Switch a filled table to seeded SipHash")
+const uint64_t seed[2] = {0x0706050403020100, 0x0f0e0d0c0b0a0908};
+INSERT_TEST_DATA(&test_table)
+ht_dyn_set_hash(&test_table, ht_hash_siphash, seed);
+ht_print_item_value(ht_dyn_get(&test_table, "Solana"));
+ENDTEST
+
+TEST(test_hashed, "Insert, search and delete with precomputed hashes")
+char *keys[] = {"Ethereum", "Solana", "Terra"};
+uint64_t hashes[3];
+for (int i = 0; i < 3; i++) {
+  hashes[i] = test_table.hash(keys[i], strlen(keys[i]), test_table.seed);
+  ht_dyn_insert_hashed(&test_table, keys[i], hashes[i], i);
+}
+ht_dyn_delete_hashed(&test_table, keys[2], hashes[2]);
+ht_print_item(ht_dyn_search_hashed(&test_table, keys[0], hashes[0]));
+ht_print_item(ht_dyn_search(&test_table, "Solana"));
+ht_print_item(ht_dyn_search_hashed(&test_table, keys[2], hashes[2]));
+ENDTEST
+
+TEST(test_arena, "Arena mode: insert, delete, reuse and delete all")
+ht_dyn_free(&test_table);
+ht_dyn_init_arena(&test_table, 0);
+INSERT_TEST_DATA(&test_table)
+ht_dyn_delete(&test_table, "Terra");
+ht_dyn_delete(&test_table, "Bitcoin");
+ht_dyn_insert(&test_table, "Monero", 230.93);
+ht_print_item(ht_dyn_search(&test_table, "Monero"));
+ht_print_item(ht_dyn_search(&test_table, "Terra"));
+printf("Slabs: %i items, %i keys\n", test_table.item_arena.slab_count,
+       test_table.key_arena.slab_count);
+ht_dyn_delete_all(&test_table);
+ht_dyn_insert(&test_table, "Ethereum", 3208.67);
+ENDTEST
+
+TEST(test_long_keys, "Keys stored inline and out of line")
+ht_dyn_insert(&test_table, "Binance Coin", 533.76);
+ht_dyn_insert(&test_table, "Shiba Inu Coin!", 0.01);
+ht_dyn_insert(&test_table, "Wrapped Bitcoin Token", 65044.11);
+ht_print_item(ht_dyn_search(&test_table, "Shiba Inu Coin!"));
+ht_print_item(ht_dyn_search(&test_table, "Wrapped Bitcoin Token"));
+printf("Inline: %s, %s\n",
+       ht_dyn_search(&test_table, "Shiba Inu Coin!")->key ==
+               ht_dyn_search(&test_table, "Shiba Inu Coin!")->inline_key
+           ? "yes"
+           : "no",
+       ht_dyn_search(&test_table, "Wrapped Bitcoin Token")->key ==
+               ht_dyn_search(&test_table, "Wrapped Bitcoin Token")->inline_key
+           ? "yes"
+           : "no");
+ht_dyn_delete(&test_table, "Wrapped Bitcoin Token");
+ht_print_item(ht_dyn_search(&test_table, "Wrapped Bitcoin Token"));
+ENDTEST
+
+TEST(test_interned, "Interned mode: canonical keys, pointer lookups")
+ht_intern_pool_t pool;
+char key[] = "Bitcoin";
+ht_intern_init(&pool);
+ht_dyn_free(&test_table);
+ht_dyn_init_interned(&test_table, 0, &pool);
+INSERT_TEST_DATA(&test_table)
+ht_dyn_insert(&test_table, key, 60000.00);
+ht_print_item(ht_dyn_search(&test_table, key));
+ht_print_item(ht_dyn_search(&test_table, "Monero"));
+printf("Canonical: %s\n", ht_intern(&pool, key) == ht_intern(&pool, "Bitcoin")
+                                ? "yes"
+                                : "no");
+ht_print_item(ht_dyn_search_interned(&test_table, ht_intern_find(&pool, key)));
+ht_print_item(ht_dyn_search_interned(&test_table, key));
+ht_dyn_delete(&test_table, "Bitcoin");
+ht_print_item(ht_dyn_search(&test_table, "Bitcoin"));
+printf("Pool: %i strings, table: %i items\n", ht_intern_count(&pool),
+       test_table.count);
+// Bucket order depends on the addresses, only the empty table is printed
+ht_dyn_free(&test_table);
+ht_intern_free(&pool);
+ht_dyn_init(&test_table, 0);
+ENDTEST
+
+TEST(test_batch, "Batch insert and lookup")
+char *keys[15];
+float values[15];
+float *results[17];
+char *lookup[17];
+for (int i = 0; i < 15; i++) {
+  keys[i] = TEST_DATA[i].key;
+  values[i] = TEST_DATA[i].value;
+  lookup[i] = TEST_DATA[14 - i].key;
+}
+lookup[15] = "Monero";
+lookup[16] = "Bitcoin";
+ht_dyn_insert_batch(&test_table, keys, values, 15);
+printf("Found %i of 17 keys\n", ht_dyn_get_batch(&test_table, lookup, results, 17));
+printf("Solana: %s, Monero: %s\n",
+       results[8] != NULL && *results[8] == 134.50f ? "ok" : "wrong",
+       results[15] == NULL ? "NULL" : "wrong");
+ENDTEST
+
+TEST(test_batch_update, "Batch update of existing keys, the table keeps its size")
+char *keys[TEST_DATA_COUNT];
+float values[TEST_DATA_COUNT];
+INSERT_TEST_DATA(&test_table)
+for (int i = 0; i < TEST_DATA_COUNT; i++) {
+  keys[i] = TEST_DATA[i].key;
+  values[i] = i;
+}
+ht_dyn_insert_batch(&test_table, keys, values, TEST_DATA_COUNT);
+ENDTEST
+
+TEST(test_incremental, "Incremental rehash: both arrays are searched")
+test_table.migrate_step = 1;
+// The tenth item exceeds the load factor and starts the migration
+for (int i = 0; i < 10; i++) {
+  ht_dyn_insert(&test_table, TEST_DATA[i].key, TEST_DATA[i].value);
+}
+ht_print_item(ht_dyn_search(&test_table, "Bitcoin"));
+ht_print_item(ht_dyn_search(&test_table, "USD Coin"));
+ht_dyn_delete(&test_table, "Cardano");
+ht_print_item(ht_dyn_search(&test_table, "Cardano"));
+ENDTEST
+
+TEST(test_grow_large, "Insert 100000 items, all of them are found")
+char key[16];
+int found = 0;
+for (int i = 0; i < 100000; i++) {
+  sprintf(key, "key%i", i);
+  ht_dyn_insert(&test_table, key, i);
+}
+for (int i = 0; i < 100000; i++) {
+  sprintf(key, "key%i", i);
+  float *value = ht_dyn_get(&test_table, key);
+  if (value != NULL && *value == i) {
+    found++;
+  }
+}
+printf("Found %i of 100000 items\n", found);
+ENDTEST
+
+TEST(test_grow_large_incremental,
+     "Insert 100000 items incrementally, all of them are found")
+char key[16];
+int found = 0;
+test_table.migrate_step = HT_DYN_MIGRATE_STEP;
+for (int i = 0; i < 100000; i++) {
+  sprintf(key, "key%i", i);
+  ht_dyn_insert(&test_table, key, i);
+  // Every key inserted so far is reachable during the migration
+  sprintf(key, "key%i", i / 2);
+  if (ht_dyn_get(&test_table, key) == NULL) {
+    printf("Lost key%i\n", i / 2);
+  }
+}
+for (int i = 0; i < 100000; i += 2) {
+  sprintf(key, "key%i", i);
+  ht_dyn_delete(&test_table, key);
+}
+for (int i = 0; i < 100000; i++) {
+  sprintf(key, "key%i", i);
+  float *value = ht_dyn_get(&test_table, key);
+  if (value != NULL && *value == i) {
+    found++;
+  }
+}
+printf("Found %i of 50000 items\n", found);
+ENDTEST
+
+int main(int argc, char *argv[]) {
+  init_test();
+
+  test_table_init();
+  test_search_nonexist();
+  test_insert_simple();
+  test_insert_many();
+  test_insert_update();
+  test_get_nonexist();
+  test_delete();
+  test_delete_all();
+  test_resize();
+  test_set_hash();
+  test_hashed();
+  test_arena();
+  test_long_keys();
+  test_interned();
+  test_batch();
+  test_batch_update();
+  test_incremental();
+  test_grow_large();
+  test_grow_large_incremental();
+}
+
+/* End of test_dyn.c */
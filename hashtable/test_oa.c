@@ -0,0 +1,147 @@
+#include "hashtable_dyn.h"
+#include "hashtable_oa.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_TABLE_SETUP                                                       \
+  ht_oa_table_t test_table;                                                    \
+  ht_oa_init(&test_table, 0);
+
+#define TEST_TABLE_TEARDOWN                                                    \
+  ht_oa_print_table(&test_table);                                              \
+  ht_oa_free(&test_table);
+
+#define TEST_INSERT ht_oa_insert
+
+#include "test_util.h"
+
+void ht_oa_print_table(ht_oa_table_t *table) {
+  int max_distance = 0;
+  int sum_count = 0;
+
+  printf("------------HASH TABLE--------------\n");
+  for (int i = 0; i < table->size; i++) {
+    if (table->keys[i] == NULL) {
+      if (table->size <= 64) {
+        printf("%i: \n", i);
+      }
+      continue;
+    }
+    int distance =
+        (i - (int)(table->hashes[i] & (table->size - 1))) & (table->size - 1);
+    if (table->size <= 64) {
+      printf("%i: (%s,%.2f) +%i\n", i, table->keys[i], table->values[i],
+             distance);
+    }
+    if (distance > max_distance) {
+      max_distance = distance;
+    }
+    sum_count++;
+  }
+
+  ht_print_table_size(table->size, sum_count, table->count, true);
+  printf("Load factor: %.2f\n", ht_oa_load_factor(table));
+  printf("Maximum probe distance: %i\n", max_distance);
+  printf("------------------------------------\n");
+}
+
+void init_test() {
+  printf("Open Addressing Hash Table - testing script\n");
+  printf("-------------------------------------------\n");
+  printf("\n");
+}
+
+TEST(test_table_init, "Initialize the table")
+ENDTEST
+
+TEST(test_search_nonexist, "Search for a non-existing item")
+printf("%i\n", ht_oa_search(&test_table, "Ethereum"));
+ENDTEST
+
+TEST(test_insert_simple, "Insert a new item")
+ht_oa_insert(&test_table, "Ethereum", 3208.67);
+ht_print_item_value(ht_oa_get(&test_table, "Ethereum"));
+ENDTEST
+
+TEST(test_insert_many, "Insert many new items (table grows)")
+INSERT_TEST_DATA(&test_table)
+ENDTEST
+
+TEST(test_insert_update, "Update an item")
+INSERT_TEST_DATA(&test_table)
+ht_oa_insert(&test_table, "Ethereum", 12.34);
+ht_print_item_value(ht_oa_get(&test_table, "Ethereum"));
+ENDTEST
+
+TEST(test_delete, "Delete an item, its cluster shifts back")
+INSERT_TEST_DATA(&test_table)
+ht_oa_delete(&test_table, "Terra");
+ht_print_item_value(ht_oa_get(&test_table, "Terra"));
+ENDTEST
+
+TEST(test_delete_all, "Delete all the items")
+INSERT_TEST_DATA(&test_table)
+ht_oa_delete_all(&test_table);
+ENDTEST
+
+TEST(test_full_load, "Fill the table to 95 % without growth")
+char key[16];
+int found = 0;
+test_table.max_load = 0;
+ht_oa_resize(&test_table, 1024);
+for (int i = 0; i < 973; i++) {
+  sprintf(key, "key%i", i);
+  ht_oa_insert(&test_table, key, i);
+}
+for (int i = 0; i < 973; i++) {
+  sprintf(key, "key%i", i);
+  found += ht_oa_search(&test_table, key) >= 0;
+}
+printf("Found %i of 973 items\n", found);
+ENDTEST
+
+TEST(test_random_ops, "Random inserts and deletes agree with the chained table")
+ht_dyn_table_t reference;
+char key[16];
+int mismatches = 0;
+ht_dyn_init(&reference, 0);
+srand(1);
+for (int i = 0; i < 200000; i++) {
+  sprintf(key, "k%i", rand() % 5000);
+  if (rand() % 3 == 0) {
+    ht_oa_delete(&test_table, key);
+    ht_dyn_delete(&reference, key);
+  } else {
+    ht_oa_insert(&test_table, key, i);
+    ht_dyn_insert(&reference, key, i);
+  }
+}
+for (int i = 0; i < 5000; i++) {
+  sprintf(key, "k%i", i);
+  float *value = ht_oa_get(&test_table, key);
+  float *expected = ht_dyn_get(&reference, key);
+  if ((value == NULL) != (expected == NULL) ||
+      (value != NULL && *value != *expected)) {
+    mismatches++;
+  }
+}
+printf("Mismatches: %i, items: %i (expected %i)\n", mismatches,
+       test_table.count, reference.count);
+ht_dyn_free(&reference);
+ENDTEST
+
+int main(int argc, char *argv[]) {
+  init_test();
+
+  test_table_init();
+  test_search_nonexist();
+  test_insert_simple();
+  test_insert_many();
+  test_insert_update();
+  test_delete();
+  test_delete_all();
+  test_full_load();
+  test_random_ops();
+}
+
+/* End of test_oa.c */
@@ -0,0 +1,210 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "hashtable_rcu.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define READERS 6
+#define WRITERS 2
+#define KEYS 20000
+#define ROUNDS 5
+
+#define TEST_TABLE_SETUP                                                       \
+  ht_rcu_table_t test_table;                                                   \
+  ht_rcu_init(&test_table, 0);                                                 \
+  int reader = ht_rcu_register(&test_table);
+
+#define TEST_TABLE_TEARDOWN                                                    \
+  ht_rcu_unregister(&test_table, reader);                                      \
+  ht_rcu_print_table(&test_table);                                             \
+  ht_rcu_free(&test_table);
+
+#define TEST_INSERT ht_rcu_insert
+
+#include "test_util.h"
+
+void ht_rcu_print_table(ht_rcu_table_t *table) {
+  ht_rcu_buckets_t *buckets = atomic_load(&table->buckets);
+  bool print = buckets->size <= TEST_PRINT_LIMIT;
+  int max_count = 0;
+  int sum_count = 0;
+  int retired = 0;
+
+  printf("------------HASH TABLE--------------\n");
+  for (int i = 0; i < buckets->size; i++) {
+    int count = 0;
+    ht_rcu_item_t *item = atomic_load(&buckets->items[i]);
+    if (print) {
+      printf("%i: ", i);
+    }
+    while (item != NULL) {
+      if (print) {
+        printf("(%s,%.2f)", item->key, atomic_load(&item->value));
+      }
+      count++;
+      item = atomic_load(&item->next);
+    }
+    if (print) {
+      printf("\n");
+    }
+    if (count > max_count) {
+      max_count = count;
+    }
+    sum_count += count;
+  }
+  for (int i = 0; i < HT_RCU_EPOCHS; i++) {
+    for (ht_rcu_item_t *item = table->retired_items[i]; item != NULL;
+         item = item->retired_next) {
+      retired++;
+    }
+  }
+
+  // The size, the collisions and the retired items of a large table depend on
+  // the timing of concurrent writers
+  ht_print_table_size(buckets->size, sum_count, ht_rcu_count(table), print);
+  if (print) {
+    printf("Retired items: %i\n", retired);
+    printf("Maximum hash collisions: %i\n",
+           max_count == 0 ? 0 : max_count - 1);
+  }
+  printf("------------------------------------\n");
+}
+
+void print_value(ht_rcu_table_t *table, int reader, char *key) {
+  float value;
+  if (ht_rcu_get(table, reader, key, &value)) {
+    printf("%.2f\n", value);
+  } else {
+    printf("NULL\n");
+  }
+}
+
+// Work of one thread in the concurrent test
+typedef struct worker {
+  ht_rcu_table_t *table;
+  int id;
+  int found;
+  int errors;
+} worker_t;
+
+void *write_worker(void *arg) {
+  worker_t *worker = arg;
+  char key[32];
+  // Every writer owns every WRITERS-th key, the value is always the key number
+  for (int round = 0; round < ROUNDS; round++) {
+    for (int i = worker->id; i < KEYS; i += WRITERS) {
+      sprintf(key, "key%i", i);
+      ht_rcu_insert(worker->table, key, i);
+    }
+    for (int i = worker->id; i < KEYS; i += 2 * WRITERS) {
+      sprintf(key, "key%i", i);
+      ht_rcu_delete(worker->table, key);
+    }
+  }
+  return NULL;
+}
+
+void *read_worker(void *arg) {
+  worker_t *worker = arg;
+  int reader = ht_rcu_register(worker->table);
+  char key[32];
+  float value;
+  for (int round = 0; round < ROUNDS; round++) {
+    for (int i = 0; i < KEYS; i++) {
+      sprintf(key, "key%i", i);
+      if (ht_rcu_get(worker->table, reader, key, &value)) {
+        worker->found++;
+        if (value != i) {
+          worker->errors++;
+        }
+      }
+    }
+  }
+  ht_rcu_unregister(worker->table, reader);
+  return NULL;
+}
+
+void init_test() {
+  printf("Read-Mostly (RCU) Hash Table - testing script\n");
+  printf("---------------------------------------------\n");
+  printf("\n");
+}
+
+TEST(test_table_init, "Initialize the table")
+ENDTEST
+
+TEST(test_search_nonexist, "Search for a non-existing item")
+printf("%s\n", ht_rcu_contains(&test_table, reader, "Ethereum") ? "true"
+                                                                 : "false");
+ENDTEST
+
+TEST(test_insert_simple, "Insert a new item")
+ht_rcu_insert(&test_table, "Ethereum", 3208.67);
+print_value(&test_table, reader, "Ethereum");
+ENDTEST
+
+TEST(test_insert_many, "Insert many new items (table grows)")
+INSERT_TEST_DATA(&test_table)
+ENDTEST
+
+TEST(test_insert_update, "Update an item")
+INSERT_TEST_DATA(&test_table)
+ht_rcu_insert(&test_table, "Ethereum", 12.34);
+print_value(&test_table, reader, "Ethereum");
+ENDTEST
+
+TEST(test_delete, "Delete an item, it is retired and reclaimed")
+INSERT_TEST_DATA(&test_table)
+ht_rcu_delete(&test_table, "Terra");
+ht_rcu_delete(&test_table, "Bitcoin");
+print_value(&test_table, reader, "Terra");
+ht_rcu_reclaim(&test_table);
+ENDTEST
+
+TEST(test_register, "Register readers until the slots run out")
+int count = 1;
+while (ht_rcu_register(&test_table) >= 0) {
+  count++;
+}
+printf("Readers: %i\n", count);
+ENDTEST
+
+TEST(test_concurrent, "Lock-free readers during inserts, deletes and growth")
+pthread_t writers[WRITERS], readers[READERS];
+worker_t writer_work[WRITERS], reader_work[READERS];
+for (int t = 0; t < WRITERS; t++) {
+  writer_work[t] = (worker_t){&test_table, t, 0, 0};
+  pthread_create(&writers[t], NULL, write_worker, &writer_work[t]);
+}
+for (int t = 0; t < READERS; t++) {
+  reader_work[t] = (worker_t){&test_table, t, 0, 0};
+  pthread_create(&readers[t], NULL, read_worker, &reader_work[t]);
+}
+int errors = 0;
+for (int t = 0; t < WRITERS; t++) {
+  pthread_join(writers[t], NULL);
+}
+for (int t = 0; t < READERS; t++) {
+  pthread_join(readers[t], NULL);
+  errors += reader_work[t].errors;
+}
+ht_rcu_reclaim(&test_table);
+printf("Items: %i of %i, wrong values read: %i\n", ht_rcu_count(&test_table),
+       KEYS / 2, errors);
+ENDTEST
+
+int main(int argc, char *argv[]) {
+  init_test();
+
+  test_table_init();
+  test_search_nonexist();
+  test_insert_simple();
+  test_insert_many();
+  test_insert_update();
+  test_delete();
+  test_register();
+  test_concurrent();
+}
+
+/* End of test_rcu.c */
@@ -0,0 +1,166 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "hashtable_shard.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_STRIPES 4
+#define THREADS 8
+#define KEYS_PER_THREAD 20000
+
+#define TEST_TABLE_SETUP                                                       \
+  ht_shard_table_t test_table;                                                 \
+  ht_shard_init(&test_table, TEST_STRIPES, 0);
+
+#define TEST_TABLE_TEARDOWN                                                    \
+  ht_shard_print_table(&test_table);                                           \
+  ht_shard_free(&test_table);
+
+#define TEST_INSERT ht_shard_insert
+
+#include "test_util.h"
+
+void ht_shard_print_table(ht_shard_table_t *table) {
+  printf("------------HASH TABLE--------------\n");
+  for (int s = 0; s < table->stripe_count; s++) {
+    ht_dyn_table_t *stripe = &table->stripes[s].table;
+    // The size of a large stripe depends on the timing of concurrent writers
+    if (stripe->size > TEST_PRINT_LIMIT) {
+      printf("Stripe %i: %i items\n", s, stripe->count);
+      continue;
+    }
+    printf("Stripe %i: %i items in %i buckets", s, stripe->count,
+           stripe->size);
+    if (stripe->count > 0) {
+      printf(" ");
+      for (int i = 0; i < stripe->size; i++) {
+        ht_print_chain(stripe->items[i], true);
+      }
+    }
+    printf("\n");
+  }
+  printf("------------------------------------\n");
+  printf("Total items in hash table: %i\n", ht_shard_count(table));
+  printf("------------------------------------\n");
+}
+
+void print_value(ht_shard_table_t *table, char *key) {
+  float value;
+  if (ht_shard_get(table, key, &value)) {
+    printf("%.2f\n", value);
+  } else {
+    printf("NULL\n");
+  }
+}
+
+// Work of one thread in the concurrent tests
+typedef struct worker {
+  ht_shard_table_t *table;
+  int id;
+  int errors;
+} worker_t;
+
+void *insert_worker(void *arg) {
+  worker_t *worker = arg;
+  char key[32];
+  for (int i = 0; i < KEYS_PER_THREAD; i++) {
+    sprintf(key, "t%i-key%i", worker->id, i);
+    ht_shard_insert(worker->table, key, i);
+  }
+  // Delete every other key again
+  for (int i = 0; i < KEYS_PER_THREAD; i += 2) {
+    sprintf(key, "t%i-key%i", worker->id, i);
+    ht_shard_delete(worker->table, key);
+  }
+  return NULL;
+}
+
+void *read_worker(void *arg) {
+  worker_t *worker = arg;
+  char key[32];
+  float value;
+  // Keys of the other threads appear concurrently, found values must match
+  for (int round = 0; round < 4; round++) {
+    for (int i = 0; i < KEYS_PER_THREAD; i++) {
+      sprintf(key, "t%i-key%i", worker->id, i);
+      if (ht_shard_get(worker->table, key, &value) && value != i) {
+        worker->errors++;
+      }
+    }
+  }
+  return NULL;
+}
+
+void init_test() {
+  printf("Sharded Hash Table - testing script\n");
+  printf("-----------------------------------\n");
+  printf("\n");
+}
+
+TEST(test_table_init, "Initialize the table")
+ENDTEST
+
+TEST(test_search_nonexist, "Search for a non-existing item")
+printf("%s\n", ht_shard_contains(&test_table, "Ethereum") ? "true" : "false");
+ENDTEST
+
+TEST(test_insert_simple, "Insert a new item")
+ht_shard_insert(&test_table, "Ethereum", 3208.67);
+print_value(&test_table, "Ethereum");
+ENDTEST
+
+TEST(test_insert_many, "Insert many new items")
+INSERT_TEST_DATA(&test_table)
+ENDTEST
+
+TEST(test_insert_update, "Update an item")
+INSERT_TEST_DATA(&test_table)
+ht_shard_insert(&test_table, "Ethereum", 12.34);
+print_value(&test_table, "Ethereum");
+ENDTEST
+
+TEST(test_delete, "Delete an item")
+INSERT_TEST_DATA(&test_table)
+ht_shard_delete(&test_table, "Terra");
+printf("%s\n", ht_shard_contains(&test_table, "Terra") ? "true" : "false");
+ENDTEST
+
+TEST(test_delete_all, "Delete all the items")
+INSERT_TEST_DATA(&test_table)
+ht_shard_delete_all(&test_table);
+ENDTEST
+
+TEST(test_concurrent, "Concurrent writers and readers")
+pthread_t writers[THREADS], readers[THREADS];
+worker_t writer_work[THREADS], reader_work[THREADS];
+for (int t = 0; t < THREADS; t++) {
+  writer_work[t] = (worker_t){&test_table, t, 0};
+  reader_work[t] = (worker_t){&test_table, (t + 1) % THREADS, 0};
+  pthread_create(&writers[t], NULL, insert_worker, &writer_work[t]);
+  pthread_create(&readers[t], NULL, read_worker, &reader_work[t]);
+}
+int errors = 0;
+for (int t = 0; t < THREADS; t++) {
+  pthread_join(writers[t], NULL);
+  pthread_join(readers[t], NULL);
+  errors += reader_work[t].errors;
+}
+printf("Items: %i of %i, wrong values read: %i\n", ht_shard_count(&test_table),
+       THREADS * KEYS_PER_THREAD / 2, errors);
+ENDTEST
+
+int main(int argc, char *argv[]) {
+  init_test();
+
+  test_table_init();
+  test_search_nonexist();
+  test_insert_simple();
+  test_insert_many();
+  test_insert_update();
+  test_delete();
+  test_delete_all();
+  test_concurrent();
+}
+
+/* End of test_shard.c */
@@ -5,6 +5,13 @@
 
 ht_item_t *uninitialized_item;
 
+const ht_item_t TEST_DATA[TEST_DATA_COUNT] = {
+    {"Bitcoin", 53247.71}, {"Ethereum", 3208.67}, {"Binance Coin", 409.15},
+    {"Cardano", 1.82},     {"Tether", 0.86},      {"XRP", 0.93},
+    {"Solana", 134.50},    {"Polkadot", 34.99},   {"Dogecoin", 0.22},
+    {"USD Coin", 0.86},    {"Uniswap", 21.68},    {"Terra", 30.67},
+    {"Litecoin", 156.87},  {"Avalanche", 47.03},  {"Chainlink", 21.90}};
+
 void ht_print_item_value(float *value) {
   if (value != NULL) {
     printf("%.2f\n", *value);
@@ -50,6 +57,27 @@ void ht_print_table(ht_table_t *table) {
   printf("------------------------------------\n");
 }
 
+// Prints the items of a bucket chain if 'print' is set, returns their number
+int ht_print_chain(ht_item_t *item, bool print) {
+  int count = 0;
+  for (; item != NULL; item = item->next) {
+    if (print) {
+      printf("(%s,%.2f)", item->key, item->value);
+    }
+    count++;
+  }
+  return count;
+}
+
+// Prints the size and the item count of a table after the bucket listing
+void ht_print_table_size(int size, int total, int count, bool print_size) {
+  printf("------------------------------------\n");
+  if (print_size) {
+    printf("Table size: %i\n", size);
+  }
+  printf("Total items in hash table: %i (count %i)\n", total, count);
+}
+
 void init_uninitialized_item() {
   uninitialized_item = (ht_item_t *)malloc(sizeof(ht_item_t));
   uninitialized_item->key = "*UNINITIALIZED*";
@@ -2,26 +2,56 @@
 #define IAL_HASHTABLE_TEST_UTIL_H
 
 #include "hashtable.h"
+#include <stdbool.h>
+
+// The tests of a table variant define TEST_TABLE_SETUP, TEST_TABLE_TEARDOWN
+// and TEST_INSERT before including this header; the defaults test ht_table_t.
+#ifndef TEST_TABLE_SETUP
+#define TEST_TABLE_SETUP                                                       \
+  ht_table_t *test_table;                                                      \
+  init_test_table(&test_table);
+#endif
+
+#ifndef TEST_TABLE_TEARDOWN
+#define TEST_TABLE_TEARDOWN                                                    \
+  ht_print_table(test_table);                                                  \
+  ht_delete_all(test_table);                                                   \
+  free(test_table);
+#endif
+
+#ifndef TEST_INSERT
+#define TEST_INSERT ht_insert
+#endif
 
 #define TEST(NAME, DESCRIPTION)                                                \
   void NAME() {                                                                \
     printf("[%s] %s\n", #NAME, DESCRIPTION);                                   \
-    ht_table_t *test_table;                                                    \
-    init_test_table(&test_table);
+    TEST_TABLE_SETUP
 
 #define ENDTEST                                                                \
   printf("\n");                                                                \
-  ht_print_table(test_table);                                                  \
-  ht_delete_all(test_table);                                                   \
-  free(test_table);                                                            \
+  TEST_TABLE_TEARDOWN                                                          \
   printf("\n");                                                                \
   }
 
+#define INSERT_TEST_DATA(TABLE)                                                \
+  for (int i = 0; i < TEST_DATA_COUNT; i++) {                                  \
+    TEST_INSERT(TABLE, TEST_DATA[i].key, TEST_DATA[i].value);                  \
+  }
+
+// Tables with more buckets are printed without their items
+#define TEST_PRINT_LIMIT 101
+
+#define TEST_DATA_COUNT 15
+extern const ht_item_t TEST_DATA[TEST_DATA_COUNT];
+
 extern ht_item_t *uninitialized_item;
 
 void ht_print_item_value(float *value);
 void ht_print_item(ht_item_t *item);
 void ht_print_table(ht_table_t *table);
+int ht_print_chain(ht_item_t *item, bool print);
+void ht_print_table_size(int size, int total, int count, bool print_size);
 void ht_insert_many(ht_table_t *table, const ht_item_t items[], int count);
 
 void init_uninitialized_item();